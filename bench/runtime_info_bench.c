@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Measures the get, callback registration and notification paths of every runtime information key.
+ * Values are driven through vconf_set_*, so the benchmark runs against the stand-in store as well as on a device.
+ * Each result is printed as one JSON object per line.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <poll.h>
+#include <semaphore.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+typedef struct {
+	runtime_info_key_e key;
+	runtime_info_data_type_e data_type;
+	const char *name;
+	const char *vconf_key;
+	int vconf_type;
+	int values[2];
+	const char *strings[2];
+} runtime_info_bench_key_s;
+
+typedef runtime_info_bench_key_s *runtime_info_bench_key_h;
+
+#define BENCH_INT(key, data_type, vconf_key, value1, value2) \
+	{ RUNTIME_INFO_KEY_##key, RUNTIME_INFO_DATA_TYPE_##data_type, #key, vconf_key, VCONF_TYPE_INT, { value1, value2 } }
+#define BENCH_BOOL(key, vconf_key) \
+	{ RUNTIME_INFO_KEY_##key, RUNTIME_INFO_DATA_TYPE_BOOL, #key, vconf_key, VCONF_TYPE_BOOL, { 0, 1 } }
+#define BENCH_STRING(key, vconf_key, value1, value2) \
+	{ RUNTIME_INFO_KEY_##key, RUNTIME_INFO_DATA_TYPE_STRING, #key, vconf_key, VCONF_TYPE_STRING, { 0, 0 }, { value1, value2 } }
+
+/* two system values per key, which decode to different runtime information values */
+static runtime_info_bench_key_s runtime_info_bench_keys[] = {
+	BENCH_BOOL(FLIGHT_MODE_ENABLED, VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL),
+	BENCH_INT(WIFI_STATUS, INT, VCONFKEY_WIFI_STATE, VCONFKEY_WIFI_OFF, VCONFKEY_WIFI_CONNECTED),
+	BENCH_INT(BLUETOOTH_ENABLED, BOOL, VCONFKEY_BT_STATUS, VCONFKEY_BT_STATUS_OFF, VCONFKEY_BT_STATUS_ON),
+	BENCH_INT(WIFI_HOTSPOT_ENABLED, BOOL, VCONFKEY_MOBILE_HOTSPOT_MODE, VCONFKEY_MOBILE_HOTSPOT_MODE_NONE, VCONFKEY_MOBILE_HOTSPOT_MODE_WIFI),
+	BENCH_INT(BLUETOOTH_TETHERING_ENABLED, BOOL, VCONFKEY_MOBILE_HOTSPOT_MODE, VCONFKEY_MOBILE_HOTSPOT_MODE_NONE, VCONFKEY_MOBILE_HOTSPOT_MODE_BT),
+	BENCH_INT(USB_TETHERING_ENABLED, BOOL, VCONFKEY_MOBILE_HOTSPOT_MODE, VCONFKEY_MOBILE_HOTSPOT_MODE_NONE, VCONFKEY_MOBILE_HOTSPOT_MODE_USB),
+	BENCH_INT(LOCATION_SERVICE_ENABLED, BOOL, "db/location/setting/GpsEnabled", 0, 1),
+	BENCH_INT(LOCATION_ADVANCED_GPS_ENABLED, BOOL, "db/location/setting/AgpsEnabled", 0, 1),
+	BENCH_INT(LOCATION_NETWORK_POSITION_ENABLED, BOOL, "db/location/setting/NetworkEnabled", 0, 1),
+	BENCH_INT(LOCATION_SENSOR_AIDING_ENABLED, BOOL, "db/location/setting/SensorEnabled", 0, 1),
+	BENCH_BOOL(PACKET_DATA_ENABLED, VCONFKEY_3G_ENABLE),
+	BENCH_BOOL(DATA_ROAMING_ENABLED, "db/setting/data_roaming"),
+	BENCH_BOOL(SILENT_MODE_ENABLED, "db/setting/sound/sound_on"),
+	BENCH_BOOL(VIBRATION_ENABLED, "db/setting/sound/vibration_on"),
+	BENCH_BOOL(ROTATION_LOCK_ENABLED, VCONFKEY_SETAPPL_ROTATE_LOCK_BOOL),
+	BENCH_INT(24HOUR_CLOCK_FORMAT_ENABLED, BOOL, "db/menu_widget/regionformat_time1224", VCONFKEY_TIME_FORMAT_12, VCONFKEY_TIME_FORMAT_24),
+	BENCH_INT(FIRST_DAY_OF_WEEK, INT, "db/setting/weekofday_format", SETTING_WEEKOFDAY_FORMAT_SUNDAY, SETTING_WEEKOFDAY_FORMAT_MONDAY),
+	BENCH_STRING(LANGUAGE, VCONFKEY_LANGSET, "en_US.UTF-8", "ko_KR.UTF-8"),
+	BENCH_STRING(REGION, VCONFKEY_REGIONFORMAT, "en_US.UTF-8", "ko_KR.UTF-8"),
+	BENCH_INT(AUDIO_JACK_CONNECTED, BOOL, VCONFKEY_SYSMAN_EARJACK, VCONFKEY_SYSMAN_EARJACK_REMOVED, VCONFKEY_SYSMAN_EARJACK_3WIRE),
+	BENCH_INT(GPS_STATUS, INT, VCONFKEY_LOCATION_GPS_STATE, VCONFKEY_LOCATION_GPS_OFF, VCONFKEY_LOCATION_GPS_CONNECTED),
+	BENCH_INT(BATTERY_IS_CHARGING, BOOL, VCONFKEY_SYSMAN_BATTERY_CHARGE_NOW, 0, 1),
+	BENCH_INT(TV_OUT_CONNECTED, BOOL, VCONFKEY_SYSMAN_EARJACK, VCONFKEY_SYSMAN_EARJACK_REMOVED, VCONFKEY_SYSMAN_EARJACK_TVOUT),
+	BENCH_INT(AUDIO_JACK_STATUS, INT, VCONFKEY_SYSMAN_EARJACK, VCONFKEY_SYSMAN_EARJACK_REMOVED, VCONFKEY_SYSMAN_EARJACK_4WIRE),
+	BENCH_INT(SLIDING_KEYBOARD_OPENED, BOOL, VCONFKEY_SYSMAN_SLIDING_KEYBOARD, VCONFKEY_SYSMAN_SLIDING_KEYBOARD_NOT_AVAILABE, VCONFKEY_SYSMAN_SLIDING_KEYBOAED_AVAILABLE),
+	BENCH_INT(USB_CONNECTED, BOOL, VCONFKEY_SYSMAN_USB_STATUS, VCONFKEY_SYSMAN_USB_DISCONNECTED, VCONFKEY_SYSMAN_USB_AVAILABLE),
+	BENCH_INT(CHARGER_CONNECTED, BOOL, VCONFKEY_SYSMAN_CHARGER_STATUS, VCONFKEY_SYSMAN_CHARGER_DISCONNECTED, VCONFKEY_SYSMAN_CHARGER_CONNECTED),
+	BENCH_INT(VIBRATION_LEVEL_HAPTIC_FEEDBACK, INT, VCONFKEY_SETAPPL_TOUCH_FEEDBACK_VIBRATION_LEVEL_INT, 1, 5),
+};
+
+#define RUNTIME_INFO_BENCH_KEY_COUNT (sizeof(runtime_info_bench_keys) / sizeof(runtime_info_bench_keys[0]))
+#define RUNTIME_INFO_BENCH_TIMEOUT_MS 1000
+
+static int runtime_info_bench_iterations = 10000;
+static runtime_info_dispatch_mode_e runtime_info_bench_mode = RUNTIME_INFO_DISPATCH_MODE_DIRECT;
+static const char *runtime_info_bench_mode_name = "direct";
+static int runtime_info_bench_event_fd = -1;
+static unsigned long long *runtime_info_bench_samples;
+
+static sem_t runtime_info_bench_notified;
+static unsigned long long runtime_info_bench_notified_ns;
+
+static unsigned long long runtime_info_bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static int runtime_info_bench_set(runtime_info_bench_key_h bench_key, int index)
+{
+	switch (bench_key->vconf_type)
+	{
+	case VCONF_TYPE_BOOL:
+		return vconf_set_bool(bench_key->vconf_key, bench_key->values[index]);
+
+	case VCONF_TYPE_STRING:
+		return vconf_set_str(bench_key->vconf_key, bench_key->strings[index]);
+
+	default:
+		return vconf_set_int(bench_key->vconf_key, bench_key->values[index]);
+	}
+}
+
+static int runtime_info_bench_get(runtime_info_bench_key_h bench_key)
+{
+	int int_value;
+	bool bool_value;
+	double double_value;
+	char *string_value;
+	int retcode;
+
+	switch (bench_key->data_type)
+	{
+	case RUNTIME_INFO_DATA_TYPE_INT:
+		return runtime_info_get_value_int(bench_key->key, &int_value);
+
+	case RUNTIME_INFO_DATA_TYPE_BOOL:
+		return runtime_info_get_value_bool(bench_key->key, &bool_value);
+
+	case RUNTIME_INFO_DATA_TYPE_DOUBLE:
+		return runtime_info_get_value_double(bench_key->key, &double_value);
+
+	default:
+		retcode = runtime_info_get_value_string(bench_key->key, &string_value);
+
+		if (retcode == RUNTIME_INFO_ERROR_NONE)
+		{
+			free(string_value);
+		}
+
+		return retcode;
+	}
+}
+
+static int runtime_info_bench_compare(const void *sample1, const void *sample2)
+{
+	unsigned long long value1 = *(const unsigned long long *)sample1;
+	unsigned long long value2 = *(const unsigned long long *)sample2;
+
+	return (value1 > value2) - (value1 < value2);
+}
+
+static void runtime_info_bench_report(const char *benchmark, runtime_info_bench_key_h bench_key, int count, int failures)
+{
+	unsigned long long total = 0;
+	unsigned long long p50 = 0;
+	unsigned long long p99 = 0;
+	int index;
+
+	if (count > 0)
+	{
+		qsort(runtime_info_bench_samples, count, sizeof(unsigned long long), runtime_info_bench_compare);
+
+		for (index = 0; index < count; index++)
+		{
+			total += runtime_info_bench_samples[index];
+		}
+
+		p50 = runtime_info_bench_samples[count * 50 / 100];
+		p99 = runtime_info_bench_samples[count * 99 / 100];
+	}
+
+	printf("{\"benchmark\":\"%s\",\"key\":\"%s\",\"mode\":\"%s\",\"iterations\":%d,\"failures\":%d,"
+		"\"p50_ns\":%llu,\"p99_ns\":%llu,\"mean_ns\":%llu}\n",
+		benchmark, bench_key->name, runtime_info_bench_mode_name, count + failures, failures,
+		p50, p99, (count > 0) ? total / count : 0);
+}
+
+static void runtime_info_bench_noop_cb(runtime_info_key_e key, void *user_data)
+{
+}
+
+static void runtime_info_bench_notified_cb(runtime_info_key_e key, void *user_data)
+{
+	runtime_info_bench_notified_ns = runtime_info_bench_now();
+	sem_post(&runtime_info_bench_notified);
+}
+
+static bool runtime_info_bench_wait_notified(void)
+{
+	struct pollfd pollfd = { .fd = runtime_info_bench_event_fd, .events = POLLIN };
+	struct timespec deadline;
+
+	if (runtime_info_bench_mode == RUNTIME_INFO_DISPATCH_MODE_EVENT_FD)
+	{
+		while (sem_trywait(&runtime_info_bench_notified))
+		{
+			if (poll(&pollfd, 1, RUNTIME_INFO_BENCH_TIMEOUT_MS) <= 0)
+			{
+				return false;
+			}
+
+			runtime_info_process_events();
+		}
+
+		return true;
+	}
+
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_sec += RUNTIME_INFO_BENCH_TIMEOUT_MS / 1000;
+
+	while (sem_timedwait(&runtime_info_bench_notified, &deadline))
+	{
+		if (errno != EINTR)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* latency of a read, served by the system store */
+static void runtime_info_bench_get_value(runtime_info_bench_key_h bench_key)
+{
+	unsigned long long start;
+	int failures = 0;
+	int count = 0;
+	int index;
+
+	for (index = 0; index < runtime_info_bench_iterations; index++)
+	{
+		start = runtime_info_bench_now();
+
+		if (runtime_info_bench_get(bench_key) != RUNTIME_INFO_ERROR_NONE)
+		{
+			failures++;
+			continue;
+		}
+
+		runtime_info_bench_samples[count++] = runtime_info_bench_now() - start;
+	}
+
+	runtime_info_bench_report("get_value", bench_key, count, failures);
+}
+
+/* latency of a read of a watched key with the cache enabled */
+static void runtime_info_bench_get_value_cached(runtime_info_bench_key_h bench_key)
+{
+	runtime_info_subscription_h subscription;
+	unsigned long long start;
+	int failures = 0;
+	int count = 0;
+	int index;
+
+	if (runtime_info_subscribe(bench_key->key, runtime_info_bench_noop_cb, NULL, &subscription) != RUNTIME_INFO_ERROR_NONE)
+	{
+		runtime_info_bench_report("get_value_cached", bench_key, 0, runtime_info_bench_iterations);
+		return;
+	}
+
+	runtime_info_set_cache_enabled(true);
+	runtime_info_bench_get(bench_key);
+
+	for (index = 0; index < runtime_info_bench_iterations; index++)
+	{
+		start = runtime_info_bench_now();
+
+		if (runtime_info_bench_get(bench_key) != RUNTIME_INFO_ERROR_NONE)
+		{
+			failures++;
+			continue;
+		}
+
+		runtime_info_bench_samples[count++] = runtime_info_bench_now() - start;
+	}
+
+	runtime_info_set_cache_enabled(false);
+	runtime_info_unsubscribe(subscription);
+
+	runtime_info_bench_report("get_value_cached", bench_key, count, failures);
+}
+
+/* cost of a runtime_info_set_changed_cb() and runtime_info_unset_changed_cb() pair, which installs and removes the system watch */
+static void runtime_info_bench_changed_cb_churn(runtime_info_bench_key_h bench_key)
+{
+	unsigned long long start;
+	int failures = 0;
+	int count = 0;
+	int index;
+
+	for (index = 0; index < runtime_info_bench_iterations; index++)
+	{
+		start = runtime_info_bench_now();
+
+		if (runtime_info_set_changed_cb(bench_key->key, runtime_info_bench_noop_cb, NULL) != RUNTIME_INFO_ERROR_NONE)
+		{
+			failures++;
+			continue;
+		}
+
+		runtime_info_unset_changed_cb(bench_key->key);
+
+		runtime_info_bench_samples[count++] = runtime_info_bench_now() - start;
+	}
+
+	runtime_info_bench_report("changed_cb_churn", bench_key, count, failures);
+}
+
+/* time from a change of the system value to the invocation of the callback */
+static void runtime_info_bench_notify(runtime_info_bench_key_h bench_key)
+{
+	unsigned long long start;
+	int failures = 0;
+	int count = 0;
+	int index;
+
+	if (runtime_info_set_changed_cb(bench_key->key, runtime_info_bench_notified_cb, NULL) != RUNTIME_INFO_ERROR_NONE)
+	{
+		runtime_info_bench_report("notify", bench_key, 0, runtime_info_bench_iterations);
+		return;
+	}
+
+	for (index = 0; index < runtime_info_bench_iterations; index++)
+	{
+		start = runtime_info_bench_now();
+
+		if (runtime_info_bench_set(bench_key, (index + 1) % 2) || runtime_info_bench_wait_notified() == false)
+		{
+			failures++;
+			continue;
+		}
+
+		runtime_info_bench_samples[count++] = runtime_info_bench_notified_ns - start;
+	}
+
+	runtime_info_unset_changed_cb(bench_key->key);
+
+	/* drops a late notification so that it is not counted for the next key */
+	while (sem_trywait(&runtime_info_bench_notified) == 0);
+
+	runtime_info_bench_set(bench_key, 0);
+
+	runtime_info_bench_report("notify", bench_key, count, failures);
+}
+
+static void runtime_info_bench_usage(const char *program)
+{
+	fprintf(stderr, "usage: %s [-n iterations] [-m direct|thread|fd]\n", program);
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned int index;
+	int option;
+
+	while ((option = getopt(argc, argv, "n:m:")) != -1)
+	{
+		switch (option)
+		{
+		case 'n':
+			runtime_info_bench_iterations = atoi(optarg);
+			break;
+
+		case 'm':
+			if (!strcmp(optarg, "direct"))
+			{
+				runtime_info_bench_mode = RUNTIME_INFO_DISPATCH_MODE_DIRECT;
+			}
+			else if (!strcmp(optarg, "thread"))
+			{
+				runtime_info_bench_mode = RUNTIME_INFO_DISPATCH_MODE_THREAD;
+			}
+			else if (!strcmp(optarg, "fd"))
+			{
+				runtime_info_bench_mode = RUNTIME_INFO_DISPATCH_MODE_EVENT_FD;
+			}
+			else
+			{
+				runtime_info_bench_usage(argv[0]);
+				return 1;
+			}
+
+			runtime_info_bench_mode_name = optarg;
+			break;
+
+		default:
+			runtime_info_bench_usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (runtime_info_bench_iterations <= 0)
+	{
+		runtime_info_bench_usage(argv[0]);
+		return 1;
+	}
+
+	runtime_info_bench_samples = calloc(runtime_info_bench_iterations, sizeof(unsigned long long));
+
+	if (runtime_info_bench_samples == NULL || sem_init(&runtime_info_bench_notified, 0, 0))
+	{
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+	if (runtime_info_bench_mode == RUNTIME_INFO_DISPATCH_MODE_EVENT_FD)
+	{
+		if (runtime_info_get_event_fd(&runtime_info_bench_event_fd) != RUNTIME_INFO_ERROR_NONE)
+		{
+			fprintf(stderr, "failed to get the event fd\n");
+			return 1;
+		}
+	}
+	else if (runtime_info_set_dispatch_mode(runtime_info_bench_mode) != RUNTIME_INFO_ERROR_NONE)
+	{
+		fprintf(stderr, "failed to set the dispatch mode\n");
+		return 1;
+	}
+
+	for (index = 0; index < RUNTIME_INFO_BENCH_KEY_COUNT; index++)
+	{
+		runtime_info_bench_set(&runtime_info_bench_keys[index], 0);
+	}
+
+	for (index = 0; index < RUNTIME_INFO_BENCH_KEY_COUNT; index++)
+	{
+		runtime_info_bench_get_value(&runtime_info_bench_keys[index]);
+		runtime_info_bench_get_value_cached(&runtime_info_bench_keys[index]);
+		runtime_info_bench_changed_cb_churn(&runtime_info_bench_keys[index]);
+		runtime_info_bench_notify(&runtime_info_bench_keys[index]);
+	}
+
+	sem_destroy(&runtime_info_bench_notified);
+	free(runtime_info_bench_samples);
+
+	return 0;
+}
@@ -38,6 +38,7 @@ typedef enum
 	RUNTIME_INFO_ERROR_INVALID_PARAMETER = TIZEN_ERROR_INVALID_PARAMETER, /**< Invalid parameter */
 	RUNTIME_INFO_ERROR_OUT_OF_MEMORY = TIZEN_ERROR_OUT_OF_MEMORY, /**< Out of memory */
 	RUNTIME_INFO_ERROR_IO_ERROR =  TIZEN_ERROR_IO_ERROR, /**< An input/output error occurred when read value from system */
+	RUNTIME_INFO_ERROR_TIMED_OUT = TIZEN_ERROR_TIMED_OUT, /**< The time limit expired */
 } runtime_info_error_e;
 
 /**
@@ -76,6 +77,28 @@ typedef enum
 } runtime_info_key_e;
 
 
+/**
+ * @brief Enumeration of data type of runtime information
+ */
+typedef enum
+{
+	RUNTIME_INFO_DATA_TYPE_STRING, /**< String */
+	RUNTIME_INFO_DATA_TYPE_INT, /**< Integer */
+	RUNTIME_INFO_DATA_TYPE_DOUBLE, /**< Double */
+	RUNTIME_INFO_DATA_TYPE_BOOL, /**< Boolean */
+} runtime_info_data_type_e;
+
+/**
+ * @brief The value of runtime information, to be read according to the data type of its key
+ */
+typedef union
+{
+	int i; /**< Value of a key of #RUNTIME_INFO_DATA_TYPE_INT */
+	bool b; /**< Value of a key of #RUNTIME_INFO_DATA_TYPE_BOOL */
+	double d; /**< Value of a key of #RUNTIME_INFO_DATA_TYPE_DOUBLE */
+	char *s; /**< Value of a key of #RUNTIME_INFO_DATA_TYPE_STRING */
+} runtime_info_value_u;
+
 /**
  * @brief Enumeration of Wi-Fi status
  */
@@ -120,6 +143,57 @@ typedef enum
 	RUNTIME_INFO_AUDIO_JACK_STATUS_CONNECTED_4WIRE, /**< 4-conductor wire is connected. */
 } runtime_info_audio_jack_status_e;
 
+/**
+ * @brief Enumeration of the policies of the reads bounded by a deadline
+ */
+typedef enum
+{
+	RUNTIME_INFO_STALE_POLICY_NONE, /**< An error is returned when the value cannot be read in time */
+	RUNTIME_INFO_STALE_POLICY_LAST_KNOWN_GOOD, /**< The last value read successfully is returned instead, together with its age */
+} runtime_info_stale_policy_e;
+
+/**
+ * @brief Enumeration of the contexts from which change event callbacks are invoked
+ */
+typedef enum
+{
+	RUNTIME_INFO_DISPATCH_MODE_DIRECT, /**< Callbacks are invoked from the notification context of the system (default) */
+	RUNTIME_INFO_DISPATCH_MODE_THREAD, /**< Callbacks are invoked from a thread owned by the library */
+	RUNTIME_INFO_DISPATCH_MODE_EVENT_FD, /**< Callbacks are invoked from runtime_info_process_events() */
+} runtime_info_dispatch_mode_e;
+
+/**
+ * @brief The number of buckets of the latency histograms of #runtime_info_stats_s
+ */
+#define RUNTIME_INFO_STATS_HISTOGRAM_SIZE 32
+
+/**
+ * @brief The usage statistics of a runtime information key, counted since the process started or the last reset
+ * @details Bucket @a n of a latency histogram counts the measurements of at least 2^n and less than 2^(n+1) nanoseconds.
+ *          The last bucket also counts all longer measurements.
+ */
+typedef struct
+{
+	unsigned long long gets; /**< Number of reads requested by the application */
+	unsigned long long backend_reads; /**< Number of reads of the system, including those made to detect changes */
+	unsigned long long cache_hits; /**< Number of reads served from the in-process cache */
+	unsigned long long backend_failures; /**< Number of reads of the system that failed */
+	unsigned long long notifications; /**< Number of change notifications received from the system */
+	unsigned long long callbacks; /**< Number of change event callbacks invoked */
+	unsigned long long duplicates_suppressed; /**< Number of notifications dropped because the value did not change or the key was already pending */
+	unsigned long long backend_read_latency[RUNTIME_INFO_STATS_HISTOGRAM_SIZE]; /**< Histogram of the duration of the reads of the system */
+	unsigned long long callback_latency[RUNTIME_INFO_STATS_HISTOGRAM_SIZE]; /**< Histogram of the duration of the change event callbacks */
+} runtime_info_stats_s;
+
+/**
+ * @brief The handle of a snapshot of all runtime information
+ */
+typedef struct runtime_info_snapshot_s *runtime_info_snapshot_h;
+
+/**
+ * @brief The handle of a change event subscription
+ */
+typedef struct runtime_info_subscription_s *runtime_info_subscription_h;
 
 /**
  * @brief   Called when the runtime information changes
@@ -131,6 +205,19 @@ typedef enum
  */
 typedef void (*runtime_info_changed_cb)(runtime_info_key_e key, void *user_data);
 
+/**
+ * @brief   Called when the value of a runtime information key changes, with the new value.
+ * @param[in] key The runtime information key that changed
+ * @param[in] data_type The data type of @a value
+ * @param[in] value The new value, valid only inside the callback; a string must not be released
+ * @param[in] timestamp_us The time the value was read, in microseconds of the monotonic clock
+ * @param[in] sequence The number of change events of @a key so far, including this one; it never decreases between calls
+ * @param[in] user_data The user data passed to runtime_info_subscribe_value()
+ * @pre runtime_info_subscribe_value() will invoke this callback function.
+ * @see runtime_info_subscribe_value()
+ */
+typedef void (*runtime_info_value_changed_cb)(runtime_info_key_e key, runtime_info_data_type_e data_type, const runtime_info_value_u *value, unsigned long long timestamp_us, unsigned int sequence, void *user_data);
+
 /**
  * @brief   Gets the integer value of the runtime information
  * @details This function gets current state of the given key which represents specific runtime information.
@@ -181,6 +268,372 @@ int runtime_info_get_value_double(runtime_info_key_e key, double *value);
  */
 int runtime_info_get_value_string(runtime_info_key_e key, char **value);
 
+/**
+ * @brief   Borrows the string value of the runtime information from the library.
+ * @details This function returns the same value as runtime_info_get_value_string(), in a buffer owned by the library.
+ *          While the value of @a key is cached, every call lends the same buffer, without reading the system or allocating memory.
+ * @remarks @a value stays valid, and unchanged, until it is released with runtime_info_release_value_string(),
+ *          even if the runtime information changes in the meantime. It must not be modified or released with @c free().
+ *
+ * @param[in] key The runtime information key of #RUNTIME_INFO_DATA_TYPE_STRING from which data should be read
+ * @param[out] value The current value of the given key
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when read value from system
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ *
+ * @see runtime_info_release_value_string()
+ * @see runtime_info_set_cache_enabled()
+ */
+int runtime_info_borrow_value_string(runtime_info_key_e key, const char **value);
+
+/**
+ * @brief   Releases a string value borrowed with runtime_info_borrow_value_string().
+ *
+ * @param[in] value The borrowed value
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter, or @a value was not borrowed from the library
+ *
+ * @see runtime_info_borrow_value_string()
+ */
+int runtime_info_release_value_string(const char *value);
+
+/**
+ * @brief   Gets the values of several boolean runtime information keys in a single load.
+ * @details Bit (1 << key) of @a mask selects a key of #RUNTIME_INFO_DATA_TYPE_BOOL, and the same bit of @a bits receives its value.
+ *          The library keeps the values of the requested keys in one word updated on change notifications:
+ *          the first request for a key reads it from the system and watches it for the rest of the process,
+ *          later requests are served from memory.
+ *
+ * @param[in] mask The mask of the keys to read
+ * @param[out] bits The values of the keys of @a mask, @c 0 for the other bits
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter, or a key of @a mask which is not boolean
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when read value from system
+ */
+int runtime_info_get_bool_mask(unsigned long long mask, unsigned long long *bits);
+
+/**
+ * @brief   Gets the values of several runtime information keys at once
+ * @details Keys that are decoded from the same system setting share a single read of that setting,
+ *          so reading many related keys costs one system read per distinct setting instead of one per key.
+ * @remarks The string values in @a values must be released with @c free() by you.
+ * @param[in] keys The runtime information keys from which data should be read
+ * @param[in] count The number of keys in @a keys
+ * @param[out] values The current values of the given keys, in the same order as @a keys
+ * @param[out] results The result of reading each key, in the same order as @a keys, or @c NULL
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when read value from system
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ */
+int runtime_info_get_values(const runtime_info_key_e *keys, int count, runtime_info_value_u *values, int *results);
+
+/**
+ * @brief   Called when an asynchronous read of a runtime information key completes
+ * @param[in] key The runtime information key
+ * @param[in] result #RUNTIME_INFO_ERROR_NONE if @a value holds the value of @a key, otherwise the error of the read
+ * @param[in] value The value of @a key, to be read according to its data type; valid only inside the callback
+ * @param[in] user_data The user data passed to runtime_info_get_value_async() or runtime_info_get_values_async()
+ * @see runtime_info_get_value_async()
+ * @see runtime_info_get_values_async()
+ */
+typedef void (*runtime_info_get_value_cb)(runtime_info_key_e key, int result, const runtime_info_value_u *value, void *user_data);
+
+/**
+ * @brief   Reads the value of the given key without blocking the calling thread.
+ * @details The value is read by a thread owned by the library. Reads requested while that thread is busy
+ *          are gathered and served together, each system key being read at most once.
+ *          The callback is invoked from the context selected by runtime_info_set_dispatch_mode():
+ *          from the library thread in #RUNTIME_INFO_DISPATCH_MODE_DIRECT and #RUNTIME_INFO_DISPATCH_MODE_THREAD,
+ *          and from runtime_info_process_events() in #RUNTIME_INFO_DISPATCH_MODE_EVENT_FD.
+ * @remarks The completion context is the one of the whole process, shared with the change event callbacks,
+ *          and cannot be chosen per call. To complete reads in a given thread, select #RUNTIME_INFO_DISPATCH_MODE_EVENT_FD
+ *          and call runtime_info_process_events() from that thread.
+ *
+ * @param[in] key The runtime information key to read
+ * @param[in] callback The callback function to invoke with the value
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR Failed to start the library thread
+ * @post runtime_info_get_value_cb() will be invoked.
+ *
+ * @see runtime_info_get_values_async()
+ */
+int runtime_info_get_value_async(runtime_info_key_e key, runtime_info_get_value_cb callback, void *user_data);
+
+/**
+ * @brief   Reads the values of several keys without blocking the calling thread.
+ * @details The keys are read together, in a single pass over the system, and the callback is invoked once per key
+ *          in the order of @a keys. See runtime_info_get_value_async().
+ *
+ * @param[in] keys The runtime information keys to read
+ * @param[in] count The number of keys
+ * @param[in] callback The callback function to invoke with each value
+ * @param[in] user_data The user data to be passed to the callback function
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR Failed to start the library thread
+ * @post runtime_info_get_value_cb() will be invoked @a count times.
+ *
+ * @see runtime_info_get_value_async()
+ */
+int runtime_info_get_values_async(const runtime_info_key_e *keys, int count, runtime_info_get_value_cb callback, void *user_data);
+
+/**
+ * @brief   Gets the int value of the given key, waiting at most the given time for the system.
+ * @details A value already known to the library is returned at once. Otherwise the value is read by a thread
+ *          owned by the library; when it is not read within @a timeout_ms, or the read fails,
+ *          #RUNTIME_INFO_STALE_POLICY_LAST_KNOWN_GOOD returns the last value read successfully instead.
+ *          A read that misses the deadline still completes in the background and refreshes that value.
+ *          The concurrent timed reads of a key share one read of the system, and a key whose read stalls
+ *          does not delay the timed reads of the other keys.
+ *
+ * @param[in] key The runtime information key from which to get the int value
+ * @param[in] timeout_ms The maximum time to wait in milliseconds, or a negative value to wait without limit
+ * @param[in] policy What to return when the value cannot be read in time
+ * @param[out] value The current value, or the last known value according to @a policy
+ * @param[out] age_ms The time elapsed since @a value was read in milliseconds, 0 for a current value; may be @c NULL
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Cannot find key in runtime information or data type is invalid
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when read value from system
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval  #RUNTIME_INFO_ERROR_TIMED_OUT The value could not be read in time and no value is known to the library
+ *
+ * @see runtime_info_get_value_int()
+ */
+int runtime_info_get_value_int_timed(runtime_info_key_e key, int timeout_ms, runtime_info_stale_policy_e policy, int *value, unsigned int *age_ms);
+
+/**
+ * @brief   Gets the bool value of the given key, waiting at most the given time for the system.
+ * @details See runtime_info_get_value_int_timed().
+ *
+ * @param[in] key The runtime information key from which to get the bool value
+ * @param[in] timeout_ms The maximum time to wait in milliseconds, or a negative value to wait without limit
+ * @param[in] policy What to return when the value cannot be read in time
+ * @param[out] value The current value, or the last known value according to @a policy
+ * @param[out] age_ms The time elapsed since @a value was read in milliseconds, 0 for a current value; may be @c NULL
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Cannot find key in runtime information or data type is invalid
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when read value from system
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval  #RUNTIME_INFO_ERROR_TIMED_OUT The value could not be read in time and no value is known to the library
+ *
+ * @see runtime_info_get_value_bool()
+ */
+int runtime_info_get_value_bool_timed(runtime_info_key_e key, int timeout_ms, runtime_info_stale_policy_e policy, bool *value, unsigned int *age_ms);
+
+/**
+ * @brief   Gets the double value of the given key, waiting at most the given time for the system.
+ * @details See runtime_info_get_value_int_timed().
+ *
+ * @param[in] key The runtime information key from which to get the double value
+ * @param[in] timeout_ms The maximum time to wait in milliseconds, or a negative value to wait without limit
+ * @param[in] policy What to return when the value cannot be read in time
+ * @param[out] value The current value, or the last known value according to @a policy
+ * @param[out] age_ms The time elapsed since @a value was read in milliseconds, 0 for a current value; may be @c NULL
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Cannot find key in runtime information or data type is invalid
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when read value from system
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval  #RUNTIME_INFO_ERROR_TIMED_OUT The value could not be read in time and no value is known to the library
+ *
+ * @see runtime_info_get_value_double()
+ */
+int runtime_info_get_value_double_timed(runtime_info_key_e key, int timeout_ms, runtime_info_stale_policy_e policy, double *value, unsigned int *age_ms);
+
+/**
+ * @brief   Gets the string value of the given key, waiting at most the given time for the system.
+ * @details See runtime_info_get_value_int_timed().
+ * @remarks @a value must be released with @c free() by you.
+ *
+ * @param[in] key The runtime information key from which to get the string value
+ * @param[in] timeout_ms The maximum time to wait in milliseconds, or a negative value to wait without limit
+ * @param[in] policy What to return when the value cannot be read in time
+ * @param[out] value The current value, or the last known value according to @a policy
+ * @param[out] age_ms The time elapsed since @a value was read in milliseconds, 0 for a current value; may be @c NULL
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Cannot find key in runtime information or data type is invalid
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when read value from system
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval  #RUNTIME_INFO_ERROR_TIMED_OUT The value could not be read in time and no value is known to the library
+ *
+ * @see runtime_info_get_value_string()
+ */
+int runtime_info_get_value_string_timed(runtime_info_key_e key, int timeout_ms, runtime_info_stale_policy_e policy, char **value, unsigned int *age_ms);
+
+
+/**
+ * @brief   Called to check whether the value of a runtime information key satisfies a condition
+ * @param[in] key The runtime information key
+ * @param[in] value The current value of @a key, to be read according to its data type
+ * @param[in] user_data The user data passed to runtime_info_wait_for()
+ * @return  @c true if the condition is satisfied, otherwise @c false
+ * @see runtime_info_wait_for()
+ */
+typedef bool (*runtime_info_value_predicate_cb)(runtime_info_key_e key, const runtime_info_value_u *value, void *user_data);
+
+/**
+ * @brief   Blocks the calling thread until the value of the given key satisfies a condition.
+ * @details The predicate is evaluated on the current value, then again each time a change event of @a key is delivered,
+ *          from the calling thread. A value that cannot be read does not satisfy the condition.
+ * @remarks The change events must be delivered by another context than the waiting thread:
+ *          the main loop, the dispatch thread of #RUNTIME_INFO_DISPATCH_MODE_THREAD,
+ *          or another thread calling runtime_info_process_events().
+ *
+ * @param[in] key The runtime information key
+ * @param[in] predicate The condition to wait for
+ * @param[in] user_data The user data to be passed to @a predicate
+ * @param[in] timeout_ms The maximum time to wait in milliseconds, or a negative value to wait without limit
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR Failed to watch the key
+ * @retval  #RUNTIME_INFO_ERROR_TIMED_OUT The condition was not satisfied within @a timeout_ms
+ *
+ * @see runtime_info_wait_for_value_int()
+ * @see runtime_info_wait_for_value_bool()
+ */
+int runtime_info_wait_for(runtime_info_key_e key, runtime_info_value_predicate_cb predicate, void *user_data, int timeout_ms);
+
+/**
+ * @brief   Blocks the calling thread until the given integer key has the expected value.
+ * @details See runtime_info_wait_for().
+ *
+ * @param[in] key The runtime information key of #RUNTIME_INFO_DATA_TYPE_INT
+ * @param[in] value The value to wait for
+ * @param[in] timeout_ms The maximum time to wait in milliseconds, or a negative value to wait without limit
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR Failed to watch the key
+ * @retval  #RUNTIME_INFO_ERROR_TIMED_OUT The key did not have @a value within @a timeout_ms
+ */
+int runtime_info_wait_for_value_int(runtime_info_key_e key, int value, int timeout_ms);
+
+/**
+ * @brief   Blocks the calling thread until the given boolean key has the expected value.
+ * @details See runtime_info_wait_for().
+ *
+ * @param[in] key The runtime information key of #RUNTIME_INFO_DATA_TYPE_BOOL
+ * @param[in] value The value to wait for
+ * @param[in] timeout_ms The maximum time to wait in milliseconds, or a negative value to wait without limit
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR Failed to watch the key
+ * @retval  #RUNTIME_INFO_ERROR_TIMED_OUT The key did not have @a value within @a timeout_ms
+ */
+int runtime_info_wait_for_value_bool(runtime_info_key_e key, bool value, int timeout_ms);
+
+/**
+ * @brief   Captures the current values of all runtime information keys
+ * @details All keys are read in a single pass, with one read per distinct system setting.
+ *          The snapshot is not atomic: a setting changed while the pass runs may be seen before or after its change.
+ *          Each snapshot is stamped with a sequence number that increases with every snapshot taken in the process.
+ * @remarks @a snapshot must be released with runtime_info_snapshot_destroy() by you.
+ * @param[out] snapshot The handle of the new snapshot
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @see runtime_info_snapshot_destroy()
+ */
+int runtime_info_snapshot_create(runtime_info_snapshot_h *snapshot);
+
+/**
+ * @brief   Destroys the snapshot
+ * @param[in] snapshot The handle of the snapshot
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @see runtime_info_snapshot_create()
+ */
+int runtime_info_snapshot_destroy(runtime_info_snapshot_h snapshot);
+
+/**
+ * @brief   Gets the sequence number of the snapshot
+ * @param[in] snapshot The handle of the snapshot
+ * @param[out] sequence The sequence number of the snapshot
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ */
+int runtime_info_snapshot_get_sequence(runtime_info_snapshot_h snapshot, unsigned int *sequence);
+
+/**
+ * @brief   Gets the integer value of the given key captured in the snapshot
+ * @param[in] snapshot The handle of the snapshot
+ * @param[in] key The runtime information key
+ * @param[out] value The value of the given key when the snapshot was taken
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR The value could not be read from system when the snapshot was taken
+ */
+int runtime_info_snapshot_get_value_int(runtime_info_snapshot_h snapshot, runtime_info_key_e key, int *value);
+
+/**
+ * @brief   Gets the boolean value of the given key captured in the snapshot
+ * @param[in] snapshot The handle of the snapshot
+ * @param[in] key The runtime information key
+ * @param[out] value The value of the given key when the snapshot was taken
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR The value could not be read from system when the snapshot was taken
+ */
+int runtime_info_snapshot_get_value_bool(runtime_info_snapshot_h snapshot, runtime_info_key_e key, bool *value);
+
+/**
+ * @brief   Gets the double value of the given key captured in the snapshot
+ * @param[in] snapshot The handle of the snapshot
+ * @param[in] key The runtime information key
+ * @param[out] value The value of the given key when the snapshot was taken
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR The value could not be read from system when the snapshot was taken
+ */
+int runtime_info_snapshot_get_value_double(runtime_info_snapshot_h snapshot, runtime_info_key_e key, double *value);
+
+/**
+ * @brief   Gets the string value of the given key captured in the snapshot
+ * @remarks @a value is owned by @a snapshot and is valid until the snapshot is destroyed. Do not free it.
+ * @param[in] snapshot The handle of the snapshot
+ * @param[in] key The runtime information key
+ * @param[out] value The value of the given key when the snapshot was taken
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR The value could not be read from system when the snapshot was taken
+ */
+int runtime_info_snapshot_get_value_string(runtime_info_snapshot_h snapshot, runtime_info_key_e key, const char **value);
+
+/**
+ * @brief   Compares two snapshots
+ * @details Bit (1 << key) of @a changed_keys is set for every key whose value, or whose availability, differs between the snapshots.
+ * @param[in] snapshot1 The handle of the first snapshot
+ * @param[in] snapshot2 The handle of the second snapshot
+ * @param[out] changed_keys The mask of the keys that differ
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ */
+int runtime_info_snapshot_compare(runtime_info_snapshot_h snapshot1, runtime_info_snapshot_h snapshot2, unsigned long long *changed_keys);
 
 /**
  * @brief   Registers a change event callback for given runtime information key.
@@ -212,6 +665,239 @@ int runtime_info_set_changed_cb(runtime_info_key_e key, runtime_info_changed_cb
  */
 int runtime_info_unset_changed_cb(runtime_info_key_e key);
 
+/**
+ * @brief   Subscribes to change events of the given runtime information key.
+ * @details Any number of subscriptions can be made on the same key, and each of them is notified independently.
+ *          The system is watched only once per key, whatever the number of subscriptions.
+ *
+ * @param[in] key The runtime information type
+ * @param[in] callback The callback function to invoke
+ * @param[in] user_data The user data to be passed to the callback function
+ * @param[out] subscription The handle of the new subscription
+ *
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when watching the system
+ * @post runtime_info_changed_cb() will be invoked.
+ *
+ * @see runtime_info_unsubscribe()
+ */
+int runtime_info_subscribe(runtime_info_key_e key, runtime_info_changed_cb callback, void *user_data, runtime_info_subscription_h *subscription);
+
+/**
+ * @brief   Subscribes to change events of the given runtime information key, delivered with the new value.
+ * @details Behaves as runtime_info_subscribe(), but the callback receives the value already read by the library
+ *          to detect the change, so that the subscriber does not need to read it again.
+ *          All the subscribers of a change event receive the same sequence number,
+ *          which increases by one with each change event of the key.
+ *          The change events of a key are delivered one at a time and in sequence order. When changes are detected
+ *          while an event is being delivered, only the latest is delivered next, so the sequence numbers may skip
+ *          but never decrease.
+ *          The change events of a key are delivered one at a time, in sequence order; an event superseded by a newer one
+ *          before its delivery is not delivered, so a subscriber may see a gap in the sequence numbers but never a lower one.
+ *
+ * @param[in] key The runtime information type
+ * @param[in] callback The callback function to invoke
+ * @param[in] user_data The user data to be passed to the callback function
+ * @param[out] subscription The handle of the new subscription
+ *
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_OUT_OF_MEMORY Out of memory
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR An input/output error occurred when watching the system
+ * @post runtime_info_value_changed_cb() will be invoked.
+ *
+ * @see runtime_info_unsubscribe()
+ */
+int runtime_info_subscribe_value(runtime_info_key_e key, runtime_info_value_changed_cb callback, void *user_data, runtime_info_subscription_h *subscription);
+
+/**
+ * @brief   Cancels a subscription made with runtime_info_subscribe() or runtime_info_subscribe_value().
+ * @details The subscription can be cancelled from within its own callback.
+ * @remarks This function can be called from any thread. It does not wait for a dispatch in progress,
+ *          so the callback may still be running on another thread when this function returns.
+ *
+ * @param[in] subscription The handle of the subscription
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see runtime_info_subscribe()
+ * @see runtime_info_subscribe_value()
+ */
+int runtime_info_unsubscribe(runtime_info_subscription_h subscription);
+
+/**
+ * @brief   Sets the minimum interval between two change events of the given key.
+ * @details Changes that occur less than @a interval_ms after the last change event of the key are coalesced:
+ *          the callbacks are invoked once at the end of the interval, and only if the value then still differs
+ *          from the value of the last change event. An interval of 0, the default, disables coalescing.
+ * @remarks Change events delayed to the end of an interval are invoked from a thread owned by the library.
+ *
+ * @param[in] key The runtime information type
+ * @param[in] interval_ms The minimum interval between two change events, in milliseconds
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see runtime_info_set_changed_cb()
+ * @see runtime_info_subscribe()
+ */
+int runtime_info_set_changed_cb_interval(runtime_info_key_e key, unsigned int interval_ms);
+
+/**
+ * @brief   Sets the context from which change event callbacks are invoked.
+ * @details In #RUNTIME_INFO_DISPATCH_MODE_THREAD, notifications of the system are queued and the callbacks
+ *          are invoked from a thread owned by the library, so that a slow callback does not delay the notification context
+ *          and a process does not need a main loop to receive change events.
+ *          When the queue is full, further notifications of a key are coalesced into a single change event.
+ * @remarks Notifications already queued when switching from #RUNTIME_INFO_DISPATCH_MODE_THREAD to #RUNTIME_INFO_DISPATCH_MODE_DIRECT
+ *          are still delivered from the library thread.
+ *          Notifications left queued when switching from #RUNTIME_INFO_DISPATCH_MODE_EVENT_FD are delivered by the library thread
+ *          in #RUNTIME_INFO_DISPATCH_MODE_THREAD, and from within this function in #RUNTIME_INFO_DISPATCH_MODE_DIRECT.
+ *
+ * @param[in] mode The dispatch mode
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR Failed to start the dispatch thread
+ *
+ * @see runtime_info_set_changed_cb()
+ * @see runtime_info_subscribe()
+ */
+int runtime_info_set_dispatch_mode(runtime_info_dispatch_mode_e mode);
+
+/**
+ * @brief   Gets a file descriptor that becomes readable when change events are pending.
+ * @details This function switches to #RUNTIME_INFO_DISPATCH_MODE_EVENT_FD, where notifications of the system are queued
+ *          and the callbacks are invoked by runtime_info_process_events(), so that change events can be received
+ *          from an epoll or other custom event loop without a main loop or a dedicated thread.
+ * @remarks The file descriptor is owned by the library and must not be closed or read by the caller.
+ *
+ * @param[out] fd The file descriptor to poll for readability
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR Failed to create the file descriptor
+ *
+ * @see runtime_info_process_events()
+ * @see runtime_info_set_dispatch_mode()
+ */
+int runtime_info_get_event_fd(int *fd);
+
+/**
+ * @brief   Invokes the callbacks of all pending change events.
+ * @details Each pending key is dispatched once, however many notifications were queued for it,
+ *          and the callbacks are invoked from the calling thread.
+ *          It returns immediately when nothing is pending.
+ *
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ *
+ * @see runtime_info_get_event_fd()
+ */
+int runtime_info_process_events(void);
+
+/**
+ * @brief   Enables or disables the in-process cache of runtime information values.
+ * @details While the cache is enabled, the value of a key for which a change event callback is registered
+ *          is read from the system once and then served from memory until the system notifies a change.
+ *          Keys without a registered callback are always read from the system.
+ *          The cache is disabled by default.
+ *
+ * @param[in] enable @c true to enable the cache, @c false to disable it and drop all cached values
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ *
+ * @see runtime_info_is_value_cached()
+ */
+int runtime_info_set_cache_enabled(bool enable);
+
+/**
+ * @brief   Checks whether the next read of the given key is served from the in-process cache.
+ *
+ * @param[in] key The runtime information key
+ * @param[out] cached @c true if the value of @a key is cached, otherwise @c false
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see runtime_info_set_cache_enabled()
+ */
+int runtime_info_is_value_cached(runtime_info_key_e key, bool *cached);
+
+/**
+ * @brief   Publishes the values of all runtime information keys to the other processes.
+ * @details The calling process becomes the producer of the shared state page: it watches every key
+ *          and copies each new value into a read-only page mapped by the processes that enabled shared state.
+ *          A single process of the system is expected to publish; a page left by a previous producer that exited
+ *          is taken over if it is owned by the same user.
+ *
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_IO_ERROR Failed to create the shared state page, or another process publishes it
+ *
+ * @see runtime_info_unpublish_shared_state()
+ * @see runtime_info_set_shared_state_enabled()
+ */
+int runtime_info_publish_shared_state(void);
+
+/**
+ * @brief   Stops publishing the values of the runtime information keys and removes the shared state page.
+ * @details The processes reading the page go back to the system. A producer that exits without calling this function
+ *          is detected by the consumers within a second.
+ *
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ *
+ * @see runtime_info_publish_shared_state()
+ */
+int runtime_info_unpublish_shared_state(void);
+
+/**
+ * @brief   Enables or disables the reads from the shared state page.
+ * @details While enabled, a value of a key for which this process has no change event callback
+ *          is read from the page published by runtime_info_publish_shared_state(), with no system call.
+ *          Keys with a callback, keys not published and reads made while no page exists use the system as before.
+ *          Shared state is disabled by default.
+ *
+ * @param[in] enable @c true to read from the shared state page, @c false to always read from the system
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ *
+ * @see runtime_info_publish_shared_state()
+ */
+int runtime_info_set_shared_state_enabled(bool enable);
+
+/**
+ * @brief   Gets the usage statistics of the given runtime information key.
+ * @details The statistics are always collected.
+ *          Each counter is read atomically, but the counters are not read at one single instant,
+ *          so they may be slightly inconsistent with each other while the key is in use.
+ *
+ * @param[in] key The runtime information key
+ * @param[out] stats The usage statistics of @a key
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ * @retval  #RUNTIME_INFO_ERROR_INVALID_PARAMETER Invalid parameter
+ *
+ * @see runtime_info_reset_stats()
+ */
+int runtime_info_get_stats(runtime_info_key_e key, runtime_info_stats_s *stats);
+
+/**
+ * @brief   Resets the usage statistics of all runtime information keys.
+ *
+ * @return  0 on success, otherwise a negative error value.
+ * @retval  #RUNTIME_INFO_ERROR_NONE Successful
+ *
+ * @see runtime_info_get_stats()
+ */
+int runtime_info_reset_stats(void);
+
 /**
  * @}
  */
@@ -25,147 +25,184 @@ extern "C"
 {
 #endif
 
-typedef enum {
-	RUNTIME_INFO_DATA_TYPE_STRING,
-	RUNTIME_INFO_DATA_TYPE_INT,
-	RUNTIME_INFO_DATA_TYPE_DOUBLE,
-	RUNTIME_INFO_DATA_TYPE_BOOL
-} runtime_info_data_type_e;
-
-typedef union {
-	int i;
-	bool b;
-	double d;
-	char *s;
-} runtime_info_value_u;
-
 typedef runtime_info_value_u *runtime_info_value_h;
 
+#define RUNTIME_INFO_VALUE_INLINE_STRING 32
+
+/*
+ * A copy of a value owned by the library.
+ * Strings that fit are kept in the inline buffer, so that storing a value does not allocate in the common case.
+ */
+typedef struct {
+	bool valid;
+	runtime_info_value_u value;
+	char string[RUNTIME_INFO_VALUE_INLINE_STRING];
+} runtime_info_stored_value_s;
+
+typedef runtime_info_stored_value_s *runtime_info_stored_value_h;
+
 typedef int (*runtime_info_func_get_value) (runtime_info_value_h value);
 typedef int (*runtime_info_func_set_event_cb) (void);
 typedef void (*runtime_info_func_unset_event_cb) (void);
 
+int runtime_info_copy_value(runtime_info_data_type_e data_type, runtime_info_value_h dest, runtime_info_value_h src);
+void runtime_info_free_value(runtime_info_data_type_e data_type, runtime_info_value_h value);
+bool runtime_info_value_equal(runtime_info_data_type_e data_type, runtime_info_value_h value1, runtime_info_value_h value2);
+void runtime_info_stored_value_clear(runtime_info_data_type_e data_type, runtime_info_stored_value_h stored_value);
+int runtime_info_stored_value_set(runtime_info_data_type_e data_type, runtime_info_stored_value_h stored_value, runtime_info_value_h value);
+
+/*
+ * A source of the system values read by the per-key getters, addressed by vconf key names.
+ * Getters return 0 on success and a negative value otherwise.
+ * watch() arranges for runtime_info_backend_changed(data) to be called whenever the key changes.
+ * batch_begin() and batch_end() are optional; a backend able to read several keys in one round trip
+ * can load them once for the batch of reads they enclose.
+ */
+typedef struct {
+	const char *name;
+	int (*get_int) (const char *key, int *value);
+	int (*get_bool) (const char *key, bool *value);
+	int (*get_double) (const char *key, double *value);
+	int (*get_string) (const char *key, char **value);
+	void (*batch_begin) (void);
+	void (*batch_end) (void);
+	int (*watch) (const char *key, void *data);
+	void (*unwatch) (const char *key);
+} runtime_info_backend_s;
+
+typedef const runtime_info_backend_s *runtime_info_backend_h;
+
+extern const runtime_info_backend_s runtime_info_backend_vconf;
+
+runtime_info_backend_h runtime_info_get_backend(void);
+void runtime_info_backend_changed(void *data);
+
+int runtime_info_get_value(runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_value_h value);
+int runtime_info_get_data_type(runtime_info_key_e key, runtime_info_data_type_e *data_type);
+int runtime_info_get_local_value(runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_value_h value);
+int runtime_info_get_last_known_good_value(runtime_info_key_e key, runtime_info_value_h value, unsigned long long *updated_us);
 void runtime_info_updated(runtime_info_key_e key);
+void runtime_info_redispatch(runtime_info_key_e key);
+void runtime_info_dispatch(runtime_info_key_e key);
+
+bool runtime_info_dispatch_queue_push(runtime_info_key_e key);
+bool runtime_info_dispatch_wake(void);
+void runtime_info_async_complete(void);
+
+unsigned long long runtime_info_get_monotonic_us(void);
+unsigned long long runtime_info_get_monotonic_ns(void);
+int runtime_info_timer_schedule(runtime_info_key_e key, unsigned long long deadline_us);
+void runtime_info_timer_cancel(runtime_info_key_e key);
 
 int runtime_info_vconf_get_value_int(const char *vconf_key, int *value);
 int runtime_info_vconf_get_value_bool(const char *vconf_key, bool *value);
 int runtime_info_vconf_get_value_double(const char *vconf_key, double *value);
 int runtime_info_vconf_get_value_string(const char *vconf_key, char **value);
 
-int runtime_info_vconf_set_event_cb(const char *vconf_key, runtime_info_key_e runtime_info_key, int slot);
-void runtime_info_vconf_unset_event_cb(const char *vconf_key, int slot);
-
-int runtime_info_flightmode_get_value(runtime_info_value_h);
-int runtime_info_flightmode_set_event_cb(void);
-void runtime_info_flightmode_unset_event_cb(void);
-
-int runtime_info_audiojack_get_value(runtime_info_value_h);
-int runtime_info_audiojack_set_event_cb(void);
-void runtime_info_audiojack_unset_event_cb(void);
-
-int runtime_info_wifi_status_get_value(runtime_info_value_h);
-int runtime_info_wifi_status_set_event_cb(void);
-void runtime_info_wifi_status_unset_event_cb(void);
-
-int runtime_info_bt_enabled_get_value(runtime_info_value_h);
-int runtime_info_bt_enabled_set_event_cb(void);
-void runtime_info_bt_enabled_unset_event_cb(void);
-
-int runtime_info_wifi_hotspot_get_value(runtime_info_value_h);
-int runtime_info_wifi_hotspot_set_event_cb(void);
-void runtime_info_wifi_hotspot_unset_event_cb (void);
+void runtime_info_vconf_batch_begin(void);
+void runtime_info_vconf_batch_end(void);
 
-int runtime_info_bt_hotspot_get_value(runtime_info_value_h);
-int runtime_info_bt_hotspot_set_event_cb(void);
-void runtime_info_bt_hotspot_unset_event_cb(void);
+int runtime_info_power_supply_get_battery_charging(bool *charging);
+int runtime_info_power_supply_get_charger_connected(bool *connected);
+void runtime_info_power_supply_set_root(const char *root);
 
-int runtime_info_usb_hotspot_get_value(runtime_info_value_h);
-int runtime_info_usb_hotspot_set_event_cb(void);
-void runtime_info_usb_hotspot_unset_event_cb(void);
+void runtime_info_uevent_process(const char *message, int length);
+void runtime_info_uevent_watch(runtime_info_key_e key);
+void runtime_info_uevent_unwatch(runtime_info_key_e key);
+int runtime_info_uevent_get_value(runtime_info_key_e key, runtime_info_value_h value);
 
-int runtime_info_location_service_get_value(runtime_info_value_h);
-int runtime_info_location_service_set_event_cb(void);
-void runtime_info_location_service_unset_event_cb(void);
+void runtime_info_shm_attach(void);
+int runtime_info_shm_get_value(runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_value_h value);
 
-int runtime_info_location_agps_get_value(runtime_info_value_h);
-int runtime_info_location_agps_set_event_cb(void);
-void runtime_info_location_agps_unset_event_cb(void);
+int runtime_info_vconf_set_event_cb(const char *vconf_key, runtime_info_key_e runtime_info_key);
+void runtime_info_vconf_unset_event_cb(const char *vconf_key, runtime_info_key_e runtime_info_key);
 
-int runtime_info_location_network_get_value(runtime_info_value_h);
-int runtime_info_location_network_set_event_cb(void);
-void runtime_info_location_network_unset_event_cb(void);
-
-int runtime_info_location_sensor_get_value(runtime_info_value_h);
-int runtime_info_location_sensor_set_event_cb(void);
-void runtime_info_location_sensor_unset_event_cb(void);
-
-int runtime_info_packet_data_get_value(runtime_info_value_h);
-int runtime_info_packet_data_set_event_cb(void);
-void runtime_info_packet_data_unset_event_cb(void);
-
-int runtime_info_data_roaming_get_value(runtime_info_value_h);
-int runtime_info_data_roaming_set_event_cb(void);
-void runtime_info_data_roaming_unset_event_cb(void);
-
-int runtime_info_silent_mode_get_value(runtime_info_value_h);
-int runtime_info_silent_mode_set_event_cb(void);
-void runtime_info_silent_mode_unset_event_cb(void);
-
-int runtime_info_vibration_enabled_get_value(runtime_info_value_h);
-int runtime_info_vibration_enabled_set_event_cb(void);
-void runtime_info_vibration_enabled_unset_event_cb(void);
-
-int runtime_info_rotation_lock_enabled_get_value(runtime_info_value_h);
-int runtime_info_rotation_lock_enabled_set_event_cb(void);
-void runtime_info_rotation_lock_enabled_unset_event_cb(void);
-
-int runtime_info_24hour_format_get_value(runtime_info_value_h);
-int runtime_info_24hour_format_set_event_cb(void);
-void runtime_info_24hour_format_unset_event_cb(void);
-
-int runtime_info_first_day_of_week_get_value(runtime_info_value_h);
-int runtime_info_first_day_of_week_set_event_cb(void);
-void runtime_info_first_day_of_week_unset_event_cb(void);
-
-int runtime_info_language_get_value(runtime_info_value_h);
-int runtime_info_language_set_event_cb(void);
-void runtime_info_language_unset_event_cb(void);
+/*
+ * Declarative list of the runtime information keys.
+ * Each entry is X(key, data_type, name) where
+ *   key       is the suffix of RUNTIME_INFO_KEY_*,
+ *   data_type is the suffix of RUNTIME_INFO_DATA_TYPE_*,
+ *   name      is the infix of the runtime_info_<name>_get_value/set_event_cb/unset_event_cb functions.
+ * Entries must follow the order of runtime_info_key_e; this is checked at compile time.
+ */
+#define RUNTIME_INFO_KEY_LIST(X) \
+	X(FLIGHT_MODE_ENABLED, BOOL, flightmode) \
+	X(WIFI_STATUS, INT, wifi_status) \
+	X(BLUETOOTH_ENABLED, BOOL, bt_enabled) \
+	X(WIFI_HOTSPOT_ENABLED, BOOL, wifi_hotspot) \
+	X(BLUETOOTH_TETHERING_ENABLED, BOOL, bt_hotspot) \
+	X(USB_TETHERING_ENABLED, BOOL, usb_hotspot) \
+	X(LOCATION_SERVICE_ENABLED, BOOL, location_service) \
+	X(LOCATION_ADVANCED_GPS_ENABLED, BOOL, location_agps) \
+	X(LOCATION_NETWORK_POSITION_ENABLED, BOOL, location_network) \
+	X(LOCATION_SENSOR_AIDING_ENABLED, BOOL, location_sensor) \
+	X(PACKET_DATA_ENABLED, BOOL, packet_data) \
+	X(DATA_ROAMING_ENABLED, BOOL, data_roaming) \
+	X(SILENT_MODE_ENABLED, BOOL, silent_mode) \
+	X(VIBRATION_ENABLED, BOOL, vibration_enabled) \
+	X(ROTATION_LOCK_ENABLED, BOOL, rotation_lock_enabled) \
+	X(24HOUR_CLOCK_FORMAT_ENABLED, BOOL, 24hour_format) \
+	X(FIRST_DAY_OF_WEEK, INT, first_day_of_week) \
+	X(LANGUAGE, STRING, language) \
+	X(REGION, STRING, region) \
+	X(AUDIO_JACK_CONNECTED, BOOL, audiojack) \
+	X(GPS_STATUS, INT, gps_status) \
+	X(BATTERY_IS_CHARGING, BOOL, battery_charging) \
+	X(TV_OUT_CONNECTED, BOOL, tvout_connected) \
+	X(AUDIO_JACK_STATUS, INT, audio_jack_status) \
+	X(SLIDING_KEYBOARD_OPENED, BOOL, sliding_keyboard_opened) \
+	X(USB_CONNECTED, BOOL, usb_connected) \
+	X(CHARGER_CONNECTED, BOOL, charger_connected) \
+	X(VIBRATION_LEVEL_HAPTIC_FEEDBACK, INT, vibration_level_haptic_feedback)
+
+#define RUNTIME_INFO_KEY_INDEX(key, data_type, name) RUNTIME_INFO_KEY_INDEX_##key,
 
-int runtime_info_region_get_value(runtime_info_value_h);
-int runtime_info_region_set_event_cb(void);
-void runtime_info_region_unset_event_cb(void);
+typedef enum {
+	RUNTIME_INFO_KEY_LIST(RUNTIME_INFO_KEY_INDEX)
+	RUNTIME_INFO_KEY_COUNT
+} runtime_info_key_index_e;
 
-int runtime_info_gps_status_get_value(runtime_info_value_h);
-int runtime_info_gps_status_set_event_cb(void);
-void runtime_info_gps_status_unset_event_cb(void);
+/* keys are also addressed as bits of a 64-bit mask */
+#define RUNTIME_INFO_KEY_BIT(key) (1ULL << (key))
 
-int runtime_info_battery_charging_get_value(runtime_info_value_h);
-int runtime_info_battery_charging_set_event_cb(void);
-void runtime_info_battery_charging_unset_event_cb(void);
+typedef char runtime_info_key_mask_check[(RUNTIME_INFO_KEY_COUNT <= 64) ? 1 : -1];
 
-int runtime_info_tvout_connected_get_value(runtime_info_value_h value);
-int runtime_info_tvout_connected_set_event_cb();
-void runtime_info_tvout_connected_unset_event_cb();
+#define RUNTIME_INFO_KEY_DECLARE(key, data_type, name) \
+	int runtime_info_##name##_get_value(runtime_info_value_h value); \
+	int runtime_info_##name##_set_event_cb(void); \
+	void runtime_info_##name##_unset_event_cb(void);
 
-int runtime_info_audio_jack_status_get_value (runtime_info_value_h value);
-int runtime_info_audio_jack_status_set_event_cb ();
-void runtime_info_audio_jack_status_unset_event_cb();
+RUNTIME_INFO_KEY_LIST(RUNTIME_INFO_KEY_DECLARE)
 
-int runtime_info_sliding_keyboard_opened_get_value(runtime_info_value_h value);
-int runtime_info_sliding_keyboard_opened_set_event_cb();
-void runtime_info_sliding_keyboard_opened_unset_event_cb();
+/*
+ * Usage statistics, updated with relaxed atomics so that they can stay enabled on the hot paths.
+ * Counters of different keys may be read at slightly different times by runtime_info_get_stats().
+ */
+extern runtime_info_stats_s runtime_info_stats_table[RUNTIME_INFO_KEY_COUNT];
 
-int runtime_info_usb_connected_get_value(runtime_info_value_h value);
-int runtime_info_usb_connected_set_event_cb();
-void runtime_info_usb_connected_unset_event_cb();
+#define RUNTIME_INFO_STATS_COUNT(key, counter) \
+	__atomic_fetch_add(&runtime_info_stats_table[key].counter, 1, __ATOMIC_RELAXED)
 
-int runtime_info_charger_connected_get_value(runtime_info_value_h value);
-int runtime_info_charger_connected_set_event_cb();
-void runtime_info_charger_connected_unset_event_cb();
+unsigned long long runtime_info_stats_record_latency(unsigned long long *histogram, unsigned long long start_ns);
 
-int runtime_info_vibration_level_haptic_feedback_get_value(runtime_info_value_h value);
-int runtime_info_vibration_level_haptic_feedback_set_event_cb();
-void runtime_info_vibration_level_haptic_feedback_unset_event_cb();
+/*
+ * Static tracepoints of the runtime_info provider, usable from perf, LTTng or any other SystemTap SDT consumer.
+ * They are compiled in only when RUNTIME_INFO_TRACE is defined; otherwise neither the probes nor their arguments are evaluated.
+ * Durations are in nanoseconds and measured with RUNTIME_INFO_TRACE_CLOCK(), which is also compiled out.
+ */
+#ifdef RUNTIME_INFO_TRACE
+#include <sys/sdt.h>
+
+#define RUNTIME_INFO_TRACE_CLOCK() runtime_info_get_monotonic_ns()
+#define RUNTIME_INFO_TRACE1(probe, arg1) DTRACE_PROBE1(runtime_info, probe, arg1)
+#define RUNTIME_INFO_TRACE2(probe, arg1, arg2) DTRACE_PROBE2(runtime_info, probe, arg1, arg2)
+#define RUNTIME_INFO_TRACE3(probe, arg1, arg2, arg3) DTRACE_PROBE3(runtime_info, probe, arg1, arg2, arg3)
+#else
+#define RUNTIME_INFO_TRACE_CLOCK() 0ULL
+#define RUNTIME_INFO_TRACE1(probe, arg1) do { (void)sizeof(arg1); } while (0)
+#define RUNTIME_INFO_TRACE2(probe, arg1, arg2) do { (void)sizeof(arg1); (void)sizeof(arg2); } while (0)
+#define RUNTIME_INFO_TRACE3(probe, arg1, arg2, arg3) do { (void)sizeof(arg1); (void)sizeof(arg2); (void)sizeof(arg3); } while (0)
+#endif
 
 #ifdef __cplusplus
 }
@@ -17,6 +17,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
+#include <pthread.h>
 
 #include <vconf.h>
 #include <dlog.h>
@@ -30,12 +32,58 @@
 
 #define LOG_TAG "TIZEN_N_RUNTIME_INFO"
 
-#define RUNTIME_INFO_MAX -1
+#define RUNTIME_INFO_INTERNED_STRING_MAGIC 0x52495354
 
+/*
+ * A string value lent to the application by runtime_info_borrow_value_string().
+ * The item holds one reference while the value is cached, and each borrower holds another.
+ * magic tells a borrowed value from any other pointer given to runtime_info_release_value_string().
+ */
 typedef struct {
+	unsigned int magic;
+	int ref_count;
+	char string[];
+} runtime_info_interned_string_s;
+
+typedef runtime_info_interned_string_s *runtime_info_interned_string_h;
+
+typedef struct runtime_info_subscription_s {
+	runtime_info_key_e key;
 	runtime_info_changed_cb changed_cb;
+	runtime_info_value_changed_cb value_changed_cb;
 	void *user_data;
-	runtime_info_value_h most_recent_value;
+	bool removed;
+	int ref_count;
+} runtime_info_subscription_s;
+
+/*
+ * Never modified once published: dispatch takes a reference and walks it with no lock held,
+ * while subscribe and unsubscribe publish a modified copy.
+ */
+typedef struct {
+	int ref_count;
+	int count;
+	runtime_info_subscription_h subscriptions[];
+} runtime_info_subscriber_list_s;
+
+typedef runtime_info_subscriber_list_s *runtime_info_subscriber_list_h;
+
+/*
+ * A key is watched while it has at least one subscriber, or while held for the internal state of the library.
+ * mutex serializes the change detection of the key, it is never held while callbacks run.
+ * delivering is set while a thread invokes the callbacks of the key; a change detected meanwhile is left
+ * to that thread through delivery_pending, with most_recent_value and most_recent_us.
+ */
+typedef struct {
+	bool watched;
+	bool held;
+	bool delivering;
+	bool delivery_pending;
+	runtime_info_subscriber_list_h subscribers;
+	runtime_info_subscription_h changed_cb_subscription;
+	pthread_mutex_t mutex;
+	runtime_info_stored_value_s most_recent_value;
+	unsigned long long most_recent_us;
 } runtime_info_event_subscription_s;
 
 typedef runtime_info_event_subscription_s *runtime_info_event_subscription_h;
@@ -46,301 +94,262 @@ typedef struct {
 	runtime_info_func_get_value get_value;
 	runtime_info_func_set_event_cb set_event_cb;
 	runtime_info_func_unset_event_cb unset_event_cb;
-	runtime_info_event_subscription_h event_subscription;
+	runtime_info_event_subscription_s event_subscription;
+	runtime_info_stored_value_s cache;
+	unsigned int cache_generation;
+	runtime_info_interned_string_h interned;
+	unsigned int changed_cb_interval_ms;
+	unsigned long long last_dispatch_us;
+	unsigned int change_sequence;
+	runtime_info_stored_value_s last_known_good;
+	unsigned long long last_known_good_us;
 } runtime_info_item_s;
 
 typedef runtime_info_item_s *runtime_info_item_h;
 
-runtime_info_item_s runtime_info_item_table[] = {
-
-{
-	RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, /**<Indicates whether the device is in flight mode. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_flightmode_get_value,
-	runtime_info_flightmode_set_event_cb,
-	runtime_info_flightmode_unset_event_cb,
-	NULL
-},
+/* fails to compile if RUNTIME_INFO_KEY_LIST is out of order with runtime_info_key_e */
+#define RUNTIME_INFO_KEY_CHECK(key, data_type, name) \
+	typedef char runtime_info_key_check_##key[((int)RUNTIME_INFO_KEY_INDEX_##key == (int)RUNTIME_INFO_KEY_##key) ? 1 : -1];
 
+RUNTIME_INFO_KEY_LIST(RUNTIME_INFO_KEY_CHECK)
 
-{
-	RUNTIME_INFO_KEY_WIFI_STATUS, /**<Indicates the current status of Wi-Fi. */
-	RUNTIME_INFO_DATA_TYPE_INT,
-	runtime_info_wifi_status_get_value,
-	runtime_info_wifi_status_set_event_cb,
-	runtime_info_wifi_status_unset_event_cb,
-	NULL
-},
+#define RUNTIME_INFO_ITEM(key, data_type, name) \
+	[RUNTIME_INFO_KEY_##key] = { \
+		RUNTIME_INFO_KEY_##key, \
+		RUNTIME_INFO_DATA_TYPE_##data_type, \
+		runtime_info_##name##_get_value, \
+		runtime_info_##name##_set_event_cb, \
+		runtime_info_##name##_unset_event_cb, \
+		.event_subscription = { .mutex = PTHREAD_MUTEX_INITIALIZER }, \
+	},
 
+runtime_info_item_s runtime_info_item_table[RUNTIME_INFO_KEY_COUNT] = {
+	RUNTIME_INFO_KEY_LIST(RUNTIME_INFO_ITEM)
+};
 
+static int runtime_info_get_item(runtime_info_key_e key, runtime_info_item_h *runtime_info_item)
 {
-	RUNTIME_INFO_KEY_BLUETOOTH_ENABLED, /**<Indicates whether Bluetooth is enabled. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_bt_enabled_get_value,
-	runtime_info_bt_enabled_set_event_cb,
-	runtime_info_bt_enabled_unset_event_cb,
-	NULL
-},
+	if ((unsigned int)key >= RUNTIME_INFO_KEY_COUNT)
+	{
+		return -1;
+	}
 
-{
-	RUNTIME_INFO_KEY_WIFI_HOTSPOT_ENABLED, /**<Indicates whether Wi-Fi hotspot is enabled. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_wifi_hotspot_get_value,
-	runtime_info_wifi_hotspot_set_event_cb,
-	runtime_info_wifi_hotspot_unset_event_cb,
-	NULL
-},
+	*runtime_info_item = &runtime_info_item_table[key];
 
-{
-	RUNTIME_INFO_KEY_BLUETOOTH_TETHERING_ENABLED, /**<Indicates whether Bluetooth tethering is enabled. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_bt_hotspot_get_value,
-	runtime_info_bt_hotspot_set_event_cb,
-	runtime_info_bt_hotspot_unset_event_cb,
-	NULL
-},
+	return 0;
+}
 
+int runtime_info_get_data_type(runtime_info_key_e key, runtime_info_data_type_e *data_type)
 {
-	RUNTIME_INFO_KEY_USB_TETHERING_ENABLED, /**<Indicates whether USB tethering is enabled. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_usb_hotspot_get_value,
-	runtime_info_usb_hotspot_set_event_cb,
-	runtime_info_usb_hotspot_unset_event_cb,
-	NULL
-},
+	runtime_info_item_h runtime_info_item;
+
+	if (runtime_info_get_item(key, &runtime_info_item))
+	{
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	*data_type = runtime_info_item->data_type;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+/*
+ * runtime_info_rwlock guards the value cache and the published subscriber lists.
+ * It is only held to copy a value or to take a reference, so getters and dispatch run concurrently.
+ * runtime_info_subscribe_mutex serializes subscribe and unsubscribe, which never wait for a dispatch.
+ * Lock order: runtime_info_subscribe_mutex, event_subscription.mutex, runtime_info_rwlock.
+ */
+static pthread_rwlock_t runtime_info_rwlock = PTHREAD_RWLOCK_INITIALIZER;
+static pthread_mutex_t runtime_info_subscribe_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* guards the last known good values, apart from runtime_info_rwlock so that recording them never delays the getters */
+static pthread_mutex_t runtime_info_last_known_good_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static bool runtime_info_cache_enabled = false;
+
+#define RUNTIME_INFO_BOOL_KEY(key, data_type, name) \
+	| ((RUNTIME_INFO_DATA_TYPE_##data_type == RUNTIME_INFO_DATA_TYPE_BOOL) ? RUNTIME_INFO_KEY_BIT(RUNTIME_INFO_KEY_##key) : 0)
 
-{
-	RUNTIME_INFO_KEY_LOCATION_SERVICE_ENABLED, /**<Indicates whether the location service is allowed to use location data from GPS satellites. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_location_service_get_value,
-	runtime_info_location_service_set_event_cb,
-	runtime_info_location_service_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_LOCATION_ADVANCED_GPS_ENABLED, /**<Indicates whether the location service is allowed to download location data for GPS operation. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_location_agps_get_value,
-	runtime_info_location_agps_set_event_cb,
-	runtime_info_location_agps_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_LOCATION_NETWORK_POSITION_ENABLED, /**<Indicates whether the location service is allowed to use location data from cellular and Wi-Fi. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_location_network_get_value,
-	runtime_info_location_network_set_event_cb,
-	runtime_info_location_network_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_LOCATION_SENSOR_AIDING_ENABLED, /**<Indicates whether the location service is allowed to use pedestrian sensors for positioning performance. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_location_sensor_get_value,
-	runtime_info_location_sensor_set_event_cb,
-	runtime_info_location_sensor_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_PACKET_DATA_ENABLED, /**<Indicates Whether the packet data through 3G network is enabled. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_packet_data_get_value,
-	runtime_info_packet_data_set_event_cb,
-	runtime_info_packet_data_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_DATA_ROAMING_ENABLED, /**<Indicates whether data roaming is enabled. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_data_roaming_get_value,
-	runtime_info_data_roaming_set_event_cb,
-	runtime_info_data_roaming_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_SILENT_MODE_ENABLED, /**<Indicates whether the device is in silent mode. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_silent_mode_get_value,
-	runtime_info_silent_mode_set_event_cb,
-	runtime_info_silent_mode_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_VIBRATION_ENABLED, /**<Indicates whether vibration is enabled. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_vibration_enabled_get_value,
-	runtime_info_vibration_enabled_set_event_cb,
-	runtime_info_vibration_enabled_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED, /**<Indicates whether rotation lock is enabled. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_rotation_lock_enabled_get_value,
-	runtime_info_rotation_lock_enabled_set_event_cb,
-	runtime_info_rotation_lock_enabled_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_24HOUR_CLOCK_FORMAT_ENABLED, /**<Indicates the current time format. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_24hour_format_get_value,
-	runtime_info_24hour_format_set_event_cb,
-	runtime_info_24hour_format_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, /**<Indicates the first day of week. */
-	RUNTIME_INFO_DATA_TYPE_INT,
-	runtime_info_first_day_of_week_get_value,
-	runtime_info_first_day_of_week_set_event_cb,
-	runtime_info_first_day_of_week_unset_event_cb,
-	NULL
-},
-
-{
-	RUNTIME_INFO_KEY_LANGUAGE, /**<Indicates the current language setting. */
-	RUNTIME_INFO_DATA_TYPE_STRING,
-	runtime_info_language_get_value,
-	runtime_info_language_set_event_cb,
-	runtime_info_language_unset_event_cb,
-	NULL
-},
+static const unsigned long long runtime_info_bool_keys = 0 RUNTIME_INFO_KEY_LIST(RUNTIME_INFO_BOOL_KEY);
 
+/*
+ * The values of the watched boolean keys, one bit per key, updated by runtime_info_dispatch() under the mutex of the key.
+ * The keys of runtime_info_bool_tracked are held watched by runtime_info_get_bool_mask(), so their bits stay current.
+ */
+static unsigned long long runtime_info_bool_bits = 0;
+static unsigned long long runtime_info_bool_tracked = 0;
+static pthread_mutex_t runtime_info_bool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void runtime_info_bool_store(runtime_info_key_e key, bool value)
 {
-	RUNTIME_INFO_KEY_REGION, /**<Indicates the current region setting. */
-	RUNTIME_INFO_DATA_TYPE_STRING,
-	runtime_info_region_get_value,
-	runtime_info_region_set_event_cb,
-	runtime_info_region_unset_event_cb,
-	NULL
-},
+	if (value == true)
+	{
+		__atomic_fetch_or(&runtime_info_bool_bits, RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE);
+	}
+	else
+	{
+		__atomic_fetch_and(&runtime_info_bool_bits, ~RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE);
+	}
+}
 
+static void runtime_info_interned_string_release(runtime_info_interned_string_h interned)
 {
-	RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED, /**<Indicates whether audio jack is connected. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_audiojack_get_value,
-	runtime_info_audiojack_set_event_cb,
-	runtime_info_audiojack_unset_event_cb,
-	NULL
-},
+	if (__atomic_sub_fetch(&interned->ref_count, 1, __ATOMIC_ACQ_REL) == 0)
+	{
+		interned->magic = 0;
+		free(interned);
+	}
+}
 
+static void runtime_info_cache_invalidate(runtime_info_item_h runtime_info_item)
 {
-	RUNTIME_INFO_KEY_GPS_STATUS, /**<Indicates the current status of GPS. */
-	RUNTIME_INFO_DATA_TYPE_INT,
-	runtime_info_gps_status_get_value,
-	runtime_info_gps_status_set_event_cb,
-	runtime_info_gps_status_unset_event_cb,
-	NULL
-},
+	runtime_info_stored_value_clear(runtime_info_item->data_type, &runtime_info_item->cache);
+	runtime_info_item->cache_generation++;
 
+	if (runtime_info_item->interned != NULL)
+	{
+		runtime_info_interned_string_release(runtime_info_item->interned);
+		runtime_info_item->interned = NULL;
+	}
+}
 
+/*
+ * The cache is only filled while a backend watch is installed for the key,
+ * so that runtime_info_updated() can invalidate it when the value changes.
+ * A value read before the most recent invalidation is not stored.
+ */
+static void runtime_info_cache_store(runtime_info_item_h runtime_info_item, runtime_info_value_h value, unsigned int cache_generation)
 {
-	RUNTIME_INFO_KEY_BATTERY_IS_CHARGING, /**<Indicates the battery is currently charging. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_battery_charging_get_value,
-	runtime_info_battery_charging_set_event_cb,
-	runtime_info_battery_charging_unset_event_cb,
-	NULL
-},
+	if (runtime_info_cache_enabled == false || runtime_info_item->event_subscription.watched == false
+		|| runtime_info_item->cache_generation != cache_generation)
+	{
+		return;
+	}
 
+	runtime_info_stored_value_set(runtime_info_item->data_type, &runtime_info_item->cache, value);
+}
 
+/*
+ * Reads the value of the key from the sources that never block: the cache, then the shared state page.
+ * The shared state page is only used for keys this process does not watch:
+ * the producer may not have published a change yet when the watch of this process notifies it.
+ * Called with runtime_info_rwlock held for reading, after runtime_info_shm_attach() mapped the page;
+ * returns false when neither source holds the value.
+ */
+static bool runtime_info_read_local_value(runtime_info_item_h runtime_info_item, runtime_info_value_h value, int *retcode)
 {
-	RUNTIME_INFO_KEY_TV_OUT_CONNECTED, /**<Indicates whether TV out is connected. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_tvout_connected_get_value,
-	runtime_info_tvout_connected_set_event_cb,
-	runtime_info_tvout_connected_unset_event_cb,
-	NULL
-},
+	runtime_info_key_e key = runtime_info_item->key;
+	runtime_info_data_type_e data_type = runtime_info_item->data_type;
+
+	if (runtime_info_cache_enabled == true && runtime_info_item->cache.valid == true)
+	{
+		*retcode = runtime_info_copy_value(data_type, value, &runtime_info_item->cache.value);
 
+		if (*retcode != RUNTIME_INFO_ERROR_NONE)
+		{
+			LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
+		}
+		else
+		{
+			RUNTIME_INFO_STATS_COUNT(key, cache_hits);
+		}
 
-{
-	RUNTIME_INFO_KEY_AUDIO_JACK_STATUS, /**<Indicates the current status of audio jack. */
-	RUNTIME_INFO_DATA_TYPE_INT,
-	runtime_info_audio_jack_status_get_value,
-	runtime_info_audio_jack_status_set_event_cb,
-	runtime_info_audio_jack_status_unset_event_cb,
-	NULL
-},
+		return true;
+	}
 
+	if (runtime_info_item->event_subscription.watched == false
+		&& runtime_info_shm_get_value(key, data_type, value) == RUNTIME_INFO_ERROR_NONE)
+	{
+		*retcode = RUNTIME_INFO_ERROR_NONE;
+		return true;
+	}
+
+	return false;
+}
 
+/*
+ * Keeps the last value read from the system, which runtime_info_get_last_known_good_value() serves
+ * to the deadline-bounded reads when the system does not answer in time.
+ */
+static void runtime_info_last_known_good_store(runtime_info_item_h runtime_info_item, runtime_info_value_h value)
 {
-	RUNTIME_INFO_KEY_SLIDING_KEYBOARD_OPENED, /**<Indicates whether sliding keyboard is opened. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_sliding_keyboard_opened_get_value,
-	runtime_info_sliding_keyboard_opened_set_event_cb,
-	runtime_info_sliding_keyboard_opened_unset_event_cb,
-	NULL
-},
+	pthread_mutex_lock(&runtime_info_last_known_good_mutex);
 
+	if (runtime_info_stored_value_set(runtime_info_item->data_type, &runtime_info_item->last_known_good, value) == RUNTIME_INFO_ERROR_NONE)
+	{
+		runtime_info_item->last_known_good_us = runtime_info_get_monotonic_us();
+	}
 
-{
-	RUNTIME_INFO_KEY_USB_CONNECTED, /**<Indicates whether usb is connected. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_usb_connected_get_value,
-	runtime_info_usb_connected_set_event_cb,
-	runtime_info_usb_connected_unset_event_cb,
-	NULL
-},
+	pthread_mutex_unlock(&runtime_info_last_known_good_mutex);
+}
 
+/*
+ * Reads the value of the key from the cache, or from the system when the cache does not hold it.
+ * Only runtime_info_get_value() counts the read as a get, since runtime_info_dispatch() also reads through here.
+ */
+static int runtime_info_read_value(runtime_info_item_h runtime_info_item, runtime_info_value_h value)
 {
-	RUNTIME_INFO_KEY_CHARGER_CONNECTED, /**<Indicates whether charger is connected. */
-	RUNTIME_INFO_DATA_TYPE_BOOL,
-	runtime_info_charger_connected_get_value,
-	runtime_info_charger_connected_set_event_cb,
-	runtime_info_charger_connected_unset_event_cb,
-	NULL
-},
+	runtime_info_key_e key = runtime_info_item->key;
+	runtime_info_func_get_value get_value = runtime_info_item->get_value;
+	unsigned long long start;
+	unsigned long long latency;
+	unsigned int cache_generation;
+	bool cacheable;
+	int retcode;
 
-{
-	RUNTIME_INFO_KEY_VIBRATION_LEVEL_HAPTIC_FEEDBACK, /**<Indicates the current vibration level of haptic feedback. */
-	RUNTIME_INFO_DATA_TYPE_INT,
-	runtime_info_vibration_level_haptic_feedback_get_value,
-	runtime_info_vibration_level_haptic_feedback_set_event_cb,
-	runtime_info_vibration_level_haptic_feedback_unset_event_cb,
-	NULL
-},
+	if (get_value == NULL)
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to call getter for the runtime information", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
 
+	runtime_info_shm_attach();
 
-{
-	RUNTIME_INFO_MAX, RUNTIME_INFO_DATA_TYPE_INT, NULL, NULL, NULL, NULL
-}
+	pthread_rwlock_rdlock(&runtime_info_rwlock);
 
-};
+	if (runtime_info_read_local_value(runtime_info_item, value, &retcode) == true)
+	{
+		pthread_rwlock_unlock(&runtime_info_rwlock);
+		return retcode;
+	}
 
-static int runtime_info_get_item(runtime_info_key_e key, runtime_info_item_h *runtime_info_item)
-{
-	int index = 0;
+	cacheable = (runtime_info_cache_enabled == true && runtime_info_item->event_subscription.watched == true);
+	cache_generation = runtime_info_item->cache_generation;
+
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	RUNTIME_INFO_STATS_COUNT(key, backend_reads);
 
-	while (runtime_info_item_table[index].key != RUNTIME_INFO_MAX)
+	start = runtime_info_get_monotonic_ns();
+	retcode = get_value(value);
+	latency = runtime_info_stats_record_latency(runtime_info_stats_table[key].backend_read_latency, start);
+
+	RUNTIME_INFO_TRACE3(backend_read, key, retcode, latency);
+
+	if (retcode != RUNTIME_INFO_ERROR_NONE)
 	{
-		if (runtime_info_item_table[index].key == key)
-		{
-			*runtime_info_item = &runtime_info_item_table[index];
-			return 0;
-		}
+		RUNTIME_INFO_STATS_COUNT(key, backend_failures);
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to get the runtime informaion / key(%d)", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR, key);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
 
-		index++;
+	if (cacheable == true)
+	{
+		pthread_rwlock_wrlock(&runtime_info_rwlock);
+		runtime_info_cache_store(runtime_info_item, value, cache_generation);
+		pthread_rwlock_unlock(&runtime_info_rwlock);
 	}
 
- 	return -1;
+	runtime_info_last_known_good_store(runtime_info_item, value);
+
+	return RUNTIME_INFO_ERROR_NONE;
 }
 
 int runtime_info_get_value(runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_value_h value)
 {
 	runtime_info_item_h runtime_info_item;
-	runtime_info_func_get_value get_value;
+	unsigned long long start = RUNTIME_INFO_TRACE_CLOCK();
+	int retcode;
 
 	if (runtime_info_get_item(key, &runtime_info_item))
 	{
@@ -354,21 +363,65 @@ int runtime_info_get_value(runtime_info_key_e key, runtime_info_data_type_e data
 		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
 	}
 
-	get_value = runtime_info_item->get_value;
+	RUNTIME_INFO_STATS_COUNT(key, gets);
+	RUNTIME_INFO_TRACE1(get_value_entry, key);
 
-	if (get_value == NULL)
+	retcode = runtime_info_read_value(runtime_info_item, value);
+
+	RUNTIME_INFO_TRACE3(get_value_exit, key, retcode, RUNTIME_INFO_TRACE_CLOCK() - start);
+
+	return retcode;
+}
+
+/*
+ * Like runtime_info_get_value(), but only from the sources that never block.
+ * Returns RUNTIME_INFO_ERROR_IO_ERROR when the value would have to be read from the system.
+ */
+int runtime_info_get_local_value(runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_value_h value)
+{
+	runtime_info_item_h runtime_info_item;
+	int retcode = RUNTIME_INFO_ERROR_IO_ERROR;
+
+	if (runtime_info_get_item(key, &runtime_info_item) || runtime_info_item->data_type != data_type)
 	{
-		LOGE("[%s] IO_ERROR(0x%08x) : failed to call getter for the runtime information", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
-		return RUNTIME_INFO_ERROR_IO_ERROR;
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	runtime_info_shm_attach();
+
+	pthread_rwlock_rdlock(&runtime_info_rwlock);
+
+	if (runtime_info_read_local_value(runtime_info_item, value, &retcode) == true)
+	{
+		RUNTIME_INFO_STATS_COUNT(key, gets);
 	}
 
-	if (get_value(value) != RUNTIME_INFO_ERROR_NONE)
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	return retcode;
+}
+
+int runtime_info_get_last_known_good_value(runtime_info_key_e key, runtime_info_value_h value, unsigned long long *updated_us)
+{
+	runtime_info_item_h runtime_info_item;
+	int retcode = RUNTIME_INFO_ERROR_IO_ERROR;
+
+	if (runtime_info_get_item(key, &runtime_info_item))
 	{
-		LOGE("[%s] IO_ERROR(0x%08x) : failed to get the runtime informaion / key(%d)", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR, key);
-		return RUNTIME_INFO_ERROR_IO_ERROR;
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
 	}
 
-	return RUNTIME_INFO_ERROR_NONE;
+	pthread_mutex_lock(&runtime_info_last_known_good_mutex);
+
+	if (runtime_info_item->last_known_good.valid == true)
+	{
+		retcode = runtime_info_copy_value(runtime_info_item->data_type, value, &runtime_info_item->last_known_good.value);
+		*updated_us = runtime_info_item->last_known_good_us;
+	}
+
+	pthread_mutex_unlock(&runtime_info_last_known_good_mutex);
+
+	return retcode;
 }
 
 int runtime_info_get_value_int(runtime_info_key_e key, int *value)
@@ -455,148 +508,903 @@ int runtime_info_get_value_string(runtime_info_key_e key, char **value)
 	return retcode;
 }
 
-int runtime_info_set_changed_cb(runtime_info_key_e key, runtime_info_changed_cb callback, void *user_data)
+/*
+ * While the value is cacheable, the interned string is kept by the item and lent again without reading the system;
+ * otherwise every call interns a new copy.
+ */
+int runtime_info_borrow_value_string(runtime_info_key_e key, const char **value)
 {
 	runtime_info_item_h runtime_info_item;
-	runtime_info_func_set_event_cb set_event_cb;
-	bool subscribe_event = false;
+	runtime_info_interned_string_h interned;
+	runtime_info_value_u runtime_info_value;
+	unsigned int cache_generation;
+	bool cacheable;
+	int length;
+	int retcode;
 
-	if (callback == NULL)
+	if (value == NULL)
 	{
-		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
 		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
 	}
 
-	if (runtime_info_get_item(key, &runtime_info_item))
+	if (runtime_info_get_item(key, &runtime_info_item) || runtime_info_item->data_type != RUNTIME_INFO_DATA_TYPE_STRING)
 	{
 		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
 		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
 	}
-	
-	set_event_cb = runtime_info_item->set_event_cb;
 
-	if (set_event_cb == NULL)
+	pthread_rwlock_rdlock(&runtime_info_rwlock);
+
+	interned = runtime_info_item->interned;
+
+	if (interned != NULL)
 	{
-		LOGE("[%s] IO_ERROR(0x%08x) : failed to set callback for the runtime information", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
-		return RUNTIME_INFO_ERROR_IO_ERROR;
+		__atomic_add_fetch(&interned->ref_count, 1, __ATOMIC_RELAXED);
 	}
 
-	if (runtime_info_item->event_subscription == NULL)
+	cacheable = (runtime_info_cache_enabled == true && runtime_info_item->event_subscription.watched == true);
+	cache_generation = runtime_info_item->cache_generation;
+
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	if (interned != NULL)
 	{
-		subscribe_event = true;
+		RUNTIME_INFO_STATS_COUNT(key, gets);
+		RUNTIME_INFO_STATS_COUNT(key, cache_hits);
 
-		runtime_info_event_subscription_h event_subscription;
-		event_subscription = malloc(sizeof(runtime_info_event_subscription_s));
-		
-		if (event_subscription == NULL)
-		{
-			LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
-			return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
-		}
+		*value = interned->string;
 
-		runtime_info_item->event_subscription = event_subscription;
-		runtime_info_item->event_subscription->most_recent_value = NULL;
+		return RUNTIME_INFO_ERROR_NONE;
 	}
 
-	runtime_info_item->event_subscription->changed_cb = callback;
-	runtime_info_item->event_subscription->user_data = user_data;
+	retcode = runtime_info_get_value(key, RUNTIME_INFO_DATA_TYPE_STRING, &runtime_info_value);
 
-	if (runtime_info_item->event_subscription->most_recent_value != NULL)
+	if (retcode != RUNTIME_INFO_ERROR_NONE)
 	{
-		free(runtime_info_item->event_subscription->most_recent_value);
+		return retcode;
 	}
 
-	runtime_info_item->event_subscription->most_recent_value = NULL;
+	length = strlen(runtime_info_value.s) + 1;
+	interned = malloc(sizeof(runtime_info_interned_string_s) + length);
 
-	if (subscribe_event == true)
+	if (interned == NULL)
 	{
-		return set_event_cb();
+		free(runtime_info_value.s);
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
+		return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
 	}
-	else
+
+	interned->magic = RUNTIME_INFO_INTERNED_STRING_MAGIC;
+	interned->ref_count = 1;
+	memcpy(interned->string, runtime_info_value.s, length);
+	free(runtime_info_value.s);
+
+	if (cacheable == true)
 	{
-		return RUNTIME_INFO_ERROR_NONE;
+		pthread_rwlock_wrlock(&runtime_info_rwlock);
+
+		if (runtime_info_item->interned == NULL && runtime_info_item->cache_generation == cache_generation
+			&& runtime_info_cache_enabled == true && runtime_info_item->event_subscription.watched == true)
+		{
+			interned->ref_count++;
+			runtime_info_item->interned = interned;
+		}
+
+		pthread_rwlock_unlock(&runtime_info_rwlock);
 	}
+
+	*value = interned->string;
+
+	return RUNTIME_INFO_ERROR_NONE;
 }
 
-int runtime_info_unset_changed_cb(runtime_info_key_e key)
+int runtime_info_release_value_string(const char *value)
+{
+	runtime_info_interned_string_h interned;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	interned = (runtime_info_interned_string_h)(value - offsetof(runtime_info_interned_string_s, string));
+
+	if (interned->magic != RUNTIME_INFO_INTERNED_STRING_MAGIC)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : the value was not borrowed from the library", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	runtime_info_interned_string_release(interned);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_get_values(const runtime_info_key_e *keys, int count, runtime_info_value_u *values, int *results)
 {
 	runtime_info_item_h runtime_info_item;
-	runtime_info_func_unset_event_cb unset_event_cb;
+	int index;
+	int retcode;
+	int result = RUNTIME_INFO_ERROR_NONE;
 
-	if (runtime_info_get_item(key, &runtime_info_item))
+	if (keys == NULL || values == NULL || count <= 0)
 	{
-		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
 		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
 	}
 
-	if (runtime_info_item->event_subscription != NULL)
+	for (index = 0; index < count; index++)
 	{
-		if (runtime_info_item->event_subscription->most_recent_value != NULL)
+		if (runtime_info_get_item(keys[index], &runtime_info_item))
 		{
-			free(runtime_info_item->event_subscription->most_recent_value);
-			runtime_info_item->event_subscription->most_recent_value = NULL;
+			LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+			return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
 		}
-
-		free(runtime_info_item->event_subscription);
-		runtime_info_item->event_subscription = NULL;
 	}
 
-	unset_event_cb = runtime_info_item->unset_event_cb;
+	runtime_info_vconf_batch_begin();
 
-	if (unset_event_cb == NULL)
+	for (index = 0; index < count; index++)
 	{
-		LOGE("[%s] IO_ERROR(0x%08x) : failed to unset callback for the runtime information", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
-		return RUNTIME_INFO_ERROR_IO_ERROR;
+		runtime_info_get_item(keys[index], &runtime_info_item);
+
+		memset(&values[index], 0, sizeof(runtime_info_value_u));
+
+		retcode = runtime_info_get_value(keys[index], runtime_info_item->data_type, &values[index]);
+
+		if (results != NULL)
+		{
+			results[index] = retcode;
+		}
+
+		if (retcode != RUNTIME_INFO_ERROR_NONE && result == RUNTIME_INFO_ERROR_NONE)
+		{
+			result = retcode;
+		}
 	}
 
-	unset_event_cb();
+	runtime_info_vconf_batch_end();
 
-	return RUNTIME_INFO_ERROR_NONE;
+	return result;
 }
 
-void runtime_info_updated(runtime_info_key_e key)
+static void runtime_info_set_watched(runtime_info_item_h runtime_info_item, bool watched)
 {
-	runtime_info_item_h runtime_info_item;
-	runtime_info_value_u current_value;
-	bool dispatch_event = true;
+	runtime_info_event_subscription_h event_subscription = &runtime_info_item->event_subscription;
 
-	if (runtime_info_get_item(key, &runtime_info_item))
+	pthread_mutex_lock(&event_subscription->mutex);
+	pthread_rwlock_wrlock(&runtime_info_rwlock);
+
+	event_subscription->watched = watched;
+	runtime_info_cache_invalidate(runtime_info_item);
+
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	if (watched == false)
 	{
-		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
-		return;
+		runtime_info_item->last_dispatch_us = 0;
+		runtime_info_stored_value_clear(runtime_info_item->data_type, &event_subscription->most_recent_value);
 	}
-	
-	if (runtime_info_item->event_subscription == NULL)
+
+	pthread_mutex_unlock(&event_subscription->mutex);
+}
+
+static int runtime_info_watch(runtime_info_item_h runtime_info_item)
+{
+	int retcode;
+
+	if (runtime_info_item->set_event_cb == NULL)
 	{
-		LOGE("[%s] IO_ERROR(0x%08x) : invalid event subscription", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
-		return;
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to set callback for the runtime information", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
 	}
 
-	memset(&current_value, 0, sizeof(runtime_info_value_u));
+	runtime_info_set_watched(runtime_info_item, true);
 
-	runtime_info_get_value(key, runtime_info_item->data_type, &current_value);
+	retcode = runtime_info_item->set_event_cb();
 
-	if (runtime_info_item->event_subscription->most_recent_value != NULL)
+	if (retcode != RUNTIME_INFO_ERROR_NONE)
 	{
-		if (!memcmp(runtime_info_item->event_subscription->most_recent_value, &current_value, sizeof(runtime_info_value_u)))
-		{
-			dispatch_event = false;
-		}
+		runtime_info_set_watched(runtime_info_item, false);
 	}
-	else
-	{
-		runtime_info_item->event_subscription->most_recent_value = calloc(1, sizeof(runtime_info_value_u));
 
-		if (runtime_info_item->event_subscription->most_recent_value == NULL)
-		{
-			LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
-			return;
-		}
+	return retcode;
+}
+
+static void runtime_info_unwatch(runtime_info_item_h runtime_info_item)
+{
+	if (runtime_info_item->unset_event_cb != NULL)
+	{
+		runtime_info_item->unset_event_cb();
 	}
 
-	if (dispatch_event == true && runtime_info_item->event_subscription->changed_cb != NULL)
+	runtime_info_timer_cancel(runtime_info_item->key);
+
+	runtime_info_set_watched(runtime_info_item, false);
+}
+
+static void runtime_info_release_subscription(runtime_info_subscription_h subscription)
+{
+	if (__sync_sub_and_fetch(&subscription->ref_count, 1) == 0)
 	{
-		memcpy(runtime_info_item->event_subscription->most_recent_value, &current_value, sizeof(runtime_info_value_u));
-		runtime_info_item->event_subscription->changed_cb(key, runtime_info_item->event_subscription->user_data);
+		free(subscription);
 	}
 }
+
+static runtime_info_subscriber_list_h runtime_info_acquire_subscribers(runtime_info_item_h runtime_info_item)
+{
+	runtime_info_subscriber_list_h subscribers;
+
+	pthread_rwlock_rdlock(&runtime_info_rwlock);
+
+	subscribers = runtime_info_item->event_subscription.subscribers;
+
+	if (subscribers != NULL)
+	{
+		__sync_add_and_fetch(&subscribers->ref_count, 1);
+	}
+
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	return subscribers;
+}
+
+static void runtime_info_release_subscribers(runtime_info_subscriber_list_h subscribers)
+{
+	int index;
+
+	if (subscribers == NULL || __sync_sub_and_fetch(&subscribers->ref_count, 1) > 0)
+	{
+		return;
+	}
+
+	for (index = 0; index < subscribers->count; index++)
+	{
+		runtime_info_release_subscription(subscribers->subscriptions[index]);
+	}
+
+	free(subscribers);
+}
+
+/*
+ * Publishes a copy of the subscriber list without the removed subscribers and the replaced one,
+ * and with the added one. Called with runtime_info_subscribe_mutex held.
+ */
+static int runtime_info_publish_subscribers(runtime_info_item_h runtime_info_item, runtime_info_subscription_h replaced, runtime_info_subscription_h added)
+{
+	runtime_info_subscriber_list_h old_subscribers = runtime_info_item->event_subscription.subscribers;
+	runtime_info_subscriber_list_h new_subscribers;
+	runtime_info_subscription_h subscription;
+	int count = (old_subscribers != NULL ? old_subscribers->count : 0) + 1;
+	int index;
+
+	new_subscribers = malloc(sizeof(runtime_info_subscriber_list_s) + count * sizeof(runtime_info_subscription_h));
+
+	if (new_subscribers == NULL)
+	{
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
+		return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	new_subscribers->ref_count = 1;
+	new_subscribers->count = 0;
+
+	for (index = 0; old_subscribers != NULL && index < old_subscribers->count; index++)
+	{
+		subscription = old_subscribers->subscriptions[index];
+
+		if (subscription != replaced && subscription->removed == false)
+		{
+			__sync_add_and_fetch(&subscription->ref_count, 1);
+			new_subscribers->subscriptions[new_subscribers->count++] = subscription;
+		}
+	}
+
+	if (added != NULL)
+	{
+		__sync_add_and_fetch(&added->ref_count, 1);
+		new_subscribers->subscriptions[new_subscribers->count++] = added;
+	}
+
+	if (new_subscribers->count == 0)
+	{
+		free(new_subscribers);
+		new_subscribers = NULL;
+	}
+
+	pthread_rwlock_wrlock(&runtime_info_rwlock);
+	runtime_info_item->event_subscription.subscribers = new_subscribers;
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	runtime_info_release_subscribers(old_subscribers);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+static void runtime_info_mark_removed(runtime_info_subscription_h subscription)
+{
+	__atomic_store_n(&subscription->removed, true, __ATOMIC_RELEASE);
+	runtime_info_release_subscription(subscription);
+}
+
+static int runtime_info_add_subscriber(runtime_info_item_h runtime_info_item, runtime_info_changed_cb callback, runtime_info_value_changed_cb value_callback, void *user_data, runtime_info_subscription_h replaced, runtime_info_subscription_h *subscription)
+{
+	runtime_info_subscription_h new_subscription;
+	bool watched = runtime_info_item->event_subscription.watched;
+	int retcode;
+
+	new_subscription = calloc(1, sizeof(runtime_info_subscription_s));
+
+	if (new_subscription == NULL)
+	{
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
+		return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	new_subscription->key = runtime_info_item->key;
+	new_subscription->changed_cb = callback;
+	new_subscription->value_changed_cb = value_callback;
+	new_subscription->user_data = user_data;
+	new_subscription->ref_count = 1;
+
+	if (watched == false)
+	{
+		retcode = runtime_info_watch(runtime_info_item);
+
+		if (retcode != RUNTIME_INFO_ERROR_NONE)
+		{
+			free(new_subscription);
+			return retcode;
+		}
+	}
+
+	retcode = runtime_info_publish_subscribers(runtime_info_item, replaced, new_subscription);
+
+	if (retcode != RUNTIME_INFO_ERROR_NONE)
+	{
+		if (watched == false)
+		{
+			runtime_info_unwatch(runtime_info_item);
+		}
+
+		free(new_subscription);
+		return retcode;
+	}
+
+	if (replaced != NULL)
+	{
+		runtime_info_mark_removed(replaced);
+	}
+
+	*subscription = new_subscription;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+/*
+ * A dispatch that took its reference to the subscriber list earlier skips the subscriber once it is marked,
+ * and the subscription is freed when the last such reference is dropped.
+ */
+static int runtime_info_remove_subscriber(runtime_info_item_h runtime_info_item, runtime_info_subscription_h subscription)
+{
+	runtime_info_subscriber_list_h subscribers = runtime_info_item->event_subscription.subscribers;
+	int index;
+
+	for (index = 0; subscribers != NULL && index < subscribers->count; index++)
+	{
+		if (subscribers->subscriptions[index] == subscription && subscription->removed == false)
+		{
+			break;
+		}
+	}
+
+	if (subscribers == NULL || index == subscribers->count)
+	{
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (runtime_info_item->event_subscription.changed_cb_subscription == subscription)
+	{
+		runtime_info_item->event_subscription.changed_cb_subscription = NULL;
+	}
+
+	runtime_info_mark_removed(subscription);
+
+	/* if the copy cannot be allocated, the marked subscriber is dropped by the next successful publish */
+	if (runtime_info_publish_subscribers(runtime_info_item, NULL, NULL) == RUNTIME_INFO_ERROR_NONE
+		&& runtime_info_item->event_subscription.subscribers == NULL && runtime_info_item->event_subscription.held == false)
+	{
+		runtime_info_unwatch(runtime_info_item);
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_subscribe(runtime_info_key_e key, runtime_info_changed_cb callback, void *user_data, runtime_info_subscription_h *subscription)
+{
+	runtime_info_item_h runtime_info_item;
+	int retcode;
+
+	if (callback == NULL || subscription == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (runtime_info_get_item(key, &runtime_info_item))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_mutex_lock(&runtime_info_subscribe_mutex);
+	retcode = runtime_info_add_subscriber(runtime_info_item, callback, NULL, user_data, NULL, subscription);
+	pthread_mutex_unlock(&runtime_info_subscribe_mutex);
+
+	return retcode;
+}
+
+int runtime_info_subscribe_value(runtime_info_key_e key, runtime_info_value_changed_cb callback, void *user_data, runtime_info_subscription_h *subscription)
+{
+	runtime_info_item_h runtime_info_item;
+	int retcode;
+
+	if (callback == NULL || subscription == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (runtime_info_get_item(key, &runtime_info_item))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_mutex_lock(&runtime_info_subscribe_mutex);
+	retcode = runtime_info_add_subscriber(runtime_info_item, NULL, callback, user_data, NULL, subscription);
+	pthread_mutex_unlock(&runtime_info_subscribe_mutex);
+
+	return retcode;
+}
+
+int runtime_info_unsubscribe(runtime_info_subscription_h subscription)
+{
+	runtime_info_item_h runtime_info_item;
+	int retcode;
+
+	if (subscription == NULL || runtime_info_get_item(subscription->key, &runtime_info_item))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_mutex_lock(&runtime_info_subscribe_mutex);
+	retcode = runtime_info_remove_subscriber(runtime_info_item, subscription);
+	pthread_mutex_unlock(&runtime_info_subscribe_mutex);
+
+	if (retcode != RUNTIME_INFO_ERROR_NONE)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid subscription", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_set_changed_cb(runtime_info_key_e key, runtime_info_changed_cb callback, void *user_data)
+{
+	runtime_info_item_h runtime_info_item;
+	runtime_info_subscription_h subscription;
+	int retcode;
+
+	if (callback == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (runtime_info_get_item(key, &runtime_info_item))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_mutex_lock(&runtime_info_subscribe_mutex);
+
+	/* replaces the subscriber of a previous call, so that a concurrent dispatch sees either one of them */
+	retcode = runtime_info_add_subscriber(runtime_info_item, callback, NULL, user_data,
+		runtime_info_item->event_subscription.changed_cb_subscription, &subscription);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		runtime_info_item->event_subscription.changed_cb_subscription = subscription;
+	}
+
+	pthread_mutex_unlock(&runtime_info_subscribe_mutex);
+
+	return retcode;
+}
+
+int runtime_info_unset_changed_cb(runtime_info_key_e key)
+{
+	runtime_info_item_h runtime_info_item;
+
+	if (runtime_info_get_item(key, &runtime_info_item))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_mutex_lock(&runtime_info_subscribe_mutex);
+
+	if (runtime_info_item->event_subscription.changed_cb_subscription != NULL)
+	{
+		runtime_info_remove_subscriber(runtime_info_item, runtime_info_item->event_subscription.changed_cb_subscription);
+	}
+
+	pthread_mutex_unlock(&runtime_info_subscribe_mutex);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+void runtime_info_updated(runtime_info_key_e key)
+{
+	if ((unsigned int)key >= RUNTIME_INFO_KEY_COUNT)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return;
+	}
+
+	RUNTIME_INFO_STATS_COUNT(key, notifications);
+	RUNTIME_INFO_TRACE1(updated, key);
+
+	runtime_info_redispatch(key);
+}
+
+/*
+ * Dispatches the key from the context of the dispatch mode, without counting a notification of the system:
+ * used by runtime_info_updated() and by the library itself, for the trailing edge of an interval.
+ */
+void runtime_info_redispatch(runtime_info_key_e key)
+{
+	if (runtime_info_dispatch_queue_push(key) == true)
+	{
+		return;
+	}
+
+	runtime_info_dispatch(key);
+}
+
+/* invokes the callbacks of the key for one change event, with no lock held */
+static void runtime_info_deliver(runtime_info_item_h runtime_info_item, runtime_info_value_h current_value, unsigned long long now, unsigned int sequence)
+{
+	runtime_info_key_e key = runtime_info_item->key;
+	runtime_info_subscriber_list_h subscribers;
+	runtime_info_subscription_h subscription;
+	unsigned long long start;
+	unsigned long long latency;
+	int index;
+
+	subscribers = runtime_info_acquire_subscribers(runtime_info_item);
+
+	for (index = 0; subscribers != NULL && index < subscribers->count; index++)
+	{
+		subscription = subscribers->subscriptions[index];
+
+		if (__atomic_load_n(&subscription->removed, __ATOMIC_ACQUIRE) == false)
+		{
+			RUNTIME_INFO_STATS_COUNT(key, callbacks);
+
+			start = runtime_info_get_monotonic_ns();
+
+			/* the value carrying subscribers get the value read by the dispatch instead of reading it again */
+			if (subscription->value_changed_cb != NULL)
+			{
+				RUNTIME_INFO_TRACE2(callback_entry, key, subscription->value_changed_cb);
+				subscription->value_changed_cb(key, runtime_info_item->data_type, current_value, now, sequence, subscription->user_data);
+			}
+			else
+			{
+				RUNTIME_INFO_TRACE2(callback_entry, key, subscription->changed_cb);
+				subscription->changed_cb(key, subscription->user_data);
+			}
+
+			latency = runtime_info_stats_record_latency(runtime_info_stats_table[key].callback_latency, start);
+
+			RUNTIME_INFO_TRACE2(callback_exit, key, latency);
+		}
+	}
+
+	runtime_info_release_subscribers(subscribers);
+}
+
+void runtime_info_dispatch(runtime_info_key_e key)
+{
+	runtime_info_item_h runtime_info_item;
+	runtime_info_event_subscription_h event_subscription;
+	runtime_info_value_u current_value;
+	unsigned long long now;
+	unsigned long long window_end;
+	unsigned int sequence;
+
+	if (runtime_info_get_item(key, &runtime_info_item))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return;
+	}
+
+	RUNTIME_INFO_TRACE1(dispatch, key);
+
+	event_subscription = &runtime_info_item->event_subscription;
+
+	pthread_mutex_lock(&event_subscription->mutex);
+
+	if (event_subscription->watched == false)
+	{
+		pthread_mutex_unlock(&event_subscription->mutex);
+		LOGE("[%s] IO_ERROR(0x%08x) : invalid event subscription", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return;
+	}
+
+	pthread_rwlock_wrlock(&runtime_info_rwlock);
+	runtime_info_cache_invalidate(runtime_info_item);
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	memset(&current_value, 0, sizeof(runtime_info_value_u));
+
+	if (runtime_info_read_value(runtime_info_item, &current_value) != RUNTIME_INFO_ERROR_NONE)
+	{
+		pthread_mutex_unlock(&event_subscription->mutex);
+		return;
+	}
+
+	if (runtime_info_item->data_type == RUNTIME_INFO_DATA_TYPE_BOOL)
+	{
+		runtime_info_bool_store(key, current_value.b);
+	}
+
+	if (event_subscription->most_recent_value.valid == true
+		&& runtime_info_value_equal(runtime_info_item->data_type, &event_subscription->most_recent_value.value, &current_value))
+	{
+		pthread_mutex_unlock(&event_subscription->mutex);
+		RUNTIME_INFO_STATS_COUNT(key, duplicates_suppressed);
+		runtime_info_free_value(runtime_info_item->data_type, &current_value);
+		return;
+	}
+
+	/*
+	 * Within the interval after the last event, defer to the trailing edge of the interval,
+	 * where this function runs again and dispatches only if the value still differs from the last event.
+	 */
+	now = runtime_info_get_monotonic_us();
+
+	if (runtime_info_item->changed_cb_interval_ms > 0)
+	{
+		window_end = runtime_info_item->last_dispatch_us + runtime_info_item->changed_cb_interval_ms * 1000ULL;
+
+		if (runtime_info_item->last_dispatch_us != 0 && now < window_end
+			&& runtime_info_timer_schedule(key, window_end) == RUNTIME_INFO_ERROR_NONE)
+		{
+			pthread_mutex_unlock(&event_subscription->mutex);
+			runtime_info_free_value(runtime_info_item->data_type, &current_value);
+			return;
+		}
+
+		runtime_info_item->last_dispatch_us = now;
+	}
+
+	runtime_info_stored_value_set(runtime_info_item->data_type, &event_subscription->most_recent_value, &current_value);
+	event_subscription->most_recent_us = now;
+	sequence = ++runtime_info_item->change_sequence;
+
+	/*
+	 * The change events of a key are delivered one at a time and in order, whichever threads detect them:
+	 * a change detected during a delivery, possibly from one of its callbacks, is delivered by the same thread
+	 * once the current one ends, with the latest value only.
+	 */
+	if (event_subscription->delivering == true)
+	{
+		event_subscription->delivery_pending = true;
+		pthread_mutex_unlock(&event_subscription->mutex);
+		runtime_info_free_value(runtime_info_item->data_type, &current_value);
+		return;
+	}
+
+	event_subscription->delivering = true;
+
+	while (1)
+	{
+		pthread_mutex_unlock(&event_subscription->mutex);
+
+		runtime_info_deliver(runtime_info_item, &current_value, now, sequence);
+		runtime_info_free_value(runtime_info_item->data_type, &current_value);
+
+		pthread_mutex_lock(&event_subscription->mutex);
+
+		if (event_subscription->delivery_pending == false || event_subscription->most_recent_value.valid == false
+			|| runtime_info_copy_value(runtime_info_item->data_type, &current_value, &event_subscription->most_recent_value.value))
+		{
+			break;
+		}
+
+		event_subscription->delivery_pending = false;
+		sequence = runtime_info_item->change_sequence;
+		now = event_subscription->most_recent_us;
+	}
+
+	event_subscription->delivering = false;
+	event_subscription->delivery_pending = false;
+
+	pthread_mutex_unlock(&event_subscription->mutex);
+}
+
+int runtime_info_set_changed_cb_interval(runtime_info_key_e key, unsigned int interval_ms)
+{
+	runtime_info_item_h runtime_info_item;
+
+	if (runtime_info_get_item(key, &runtime_info_item))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_mutex_lock(&runtime_info_item->event_subscription.mutex);
+	runtime_info_item->changed_cb_interval_ms = interval_ms;
+	pthread_mutex_unlock(&runtime_info_item->event_subscription.mutex);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_set_cache_enabled(bool enable)
+{
+	int index;
+
+	pthread_rwlock_wrlock(&runtime_info_rwlock);
+
+	runtime_info_cache_enabled = enable;
+
+	if (enable == false)
+	{
+		for (index = 0; index < RUNTIME_INFO_KEY_COUNT; index++)
+		{
+			runtime_info_cache_invalidate(&runtime_info_item_table[index]);
+		}
+	}
+
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_is_value_cached(runtime_info_key_e key, bool *cached)
+{
+	runtime_info_item_h runtime_info_item;
+
+	if (cached == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (runtime_info_get_item(key, &runtime_info_item))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_rwlock_rdlock(&runtime_info_rwlock);
+	*cached = (runtime_info_cache_enabled == true && runtime_info_item->cache.valid == true);
+	pthread_rwlock_unlock(&runtime_info_rwlock);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+/*
+ * Keeps the key watched for the life of the process, without a subscriber: runtime_info_dispatch() keeps
+ * updating the state derived from the key, and no callback runs for it.
+ */
+static int runtime_info_hold_watch(runtime_info_item_h runtime_info_item)
+{
+	int retcode = RUNTIME_INFO_ERROR_NONE;
+
+	pthread_mutex_lock(&runtime_info_subscribe_mutex);
+
+	if (runtime_info_item->event_subscription.watched == false)
+	{
+		retcode = runtime_info_watch(runtime_info_item);
+	}
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		runtime_info_item->event_subscription.held = true;
+	}
+
+	pthread_mutex_unlock(&runtime_info_subscribe_mutex);
+
+	return retcode;
+}
+
+/*
+ * Holds the given keys watched and reads their initial values.
+ * The read is serialized with runtime_info_dispatch() by the mutex of the key, so the bit ends up with the latest value.
+ */
+static int runtime_info_bool_track(unsigned long long keys)
+{
+	runtime_info_item_h runtime_info_item;
+	runtime_info_value_u value;
+	int retcode = RUNTIME_INFO_ERROR_NONE;
+	int key;
+
+	pthread_mutex_lock(&runtime_info_bool_mutex);
+
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		if (!(keys & RUNTIME_INFO_KEY_BIT(key)) || (runtime_info_bool_tracked & RUNTIME_INFO_KEY_BIT(key)))
+		{
+			continue;
+		}
+
+		runtime_info_get_item(key, &runtime_info_item);
+
+		retcode = runtime_info_hold_watch(runtime_info_item);
+
+		if (retcode != RUNTIME_INFO_ERROR_NONE)
+		{
+			break;
+		}
+
+		pthread_mutex_lock(&runtime_info_item->event_subscription.mutex);
+
+		retcode = runtime_info_read_value(runtime_info_item, &value);
+
+		if (retcode == RUNTIME_INFO_ERROR_NONE)
+		{
+			runtime_info_bool_store(key, value.b);
+		}
+
+		pthread_mutex_unlock(&runtime_info_item->event_subscription.mutex);
+
+		if (retcode != RUNTIME_INFO_ERROR_NONE)
+		{
+			break;
+		}
+
+		__atomic_fetch_or(&runtime_info_bool_tracked, RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE);
+	}
+
+	pthread_mutex_unlock(&runtime_info_bool_mutex);
+
+	return retcode;
+}
+
+int runtime_info_get_bool_mask(unsigned long long mask, unsigned long long *bits)
+{
+	unsigned long long untracked;
+	int retcode;
+
+	if (bits == NULL || (mask & ~runtime_info_bool_keys))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	untracked = mask & ~__atomic_load_n(&runtime_info_bool_tracked, __ATOMIC_ACQUIRE);
+
+	if (untracked != 0)
+	{
+		retcode = runtime_info_bool_track(untracked);
+
+		if (retcode != RUNTIME_INFO_ERROR_NONE)
+		{
+			LOGE("[%s] IO_ERROR(0x%08x) : failed to track the keys", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+			return RUNTIME_INFO_ERROR_IO_ERROR;
+		}
+	}
+
+	*bits = __atomic_load_n(&runtime_info_bool_bits, __ATOMIC_ACQUIRE) & mask;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
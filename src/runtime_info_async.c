@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+typedef struct runtime_info_async_request_s {
+	struct runtime_info_async_request_s *next;
+	runtime_info_key_e key;
+	runtime_info_data_type_e data_type;
+	runtime_info_get_value_cb callback;
+	void *user_data;
+	int result;
+	runtime_info_value_u value;
+} runtime_info_async_request_s;
+
+typedef runtime_info_async_request_s *runtime_info_async_request_h;
+
+/*
+ * Requests wait in pending until the library thread takes all of them at once and reads them in one vconf batch.
+ * The read requests then wait in completed until their callbacks are invoked from the dispatch context.
+ * Both lists are kept in request order.
+ */
+static pthread_mutex_t runtime_info_async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t runtime_info_async_cond = PTHREAD_COND_INITIALIZER;
+static bool runtime_info_async_started = false;
+static runtime_info_async_request_h runtime_info_async_pending = NULL;
+static runtime_info_async_request_h *runtime_info_async_pending_tail = &runtime_info_async_pending;
+static runtime_info_async_request_h runtime_info_async_completed = NULL;
+static runtime_info_async_request_h *runtime_info_async_completed_tail = &runtime_info_async_completed;
+
+static void runtime_info_async_read(runtime_info_async_request_h requests)
+{
+	runtime_info_async_request_h request;
+
+	runtime_info_vconf_batch_begin();
+
+	for (request = requests; request != NULL; request = request->next)
+	{
+		request->result = runtime_info_get_value(request->key, request->data_type, &request->value);
+	}
+
+	runtime_info_vconf_batch_end();
+}
+
+void runtime_info_async_complete(void)
+{
+	runtime_info_async_request_h requests;
+	runtime_info_async_request_h request;
+
+	pthread_mutex_lock(&runtime_info_async_mutex);
+
+	requests = runtime_info_async_completed;
+	runtime_info_async_completed = NULL;
+	runtime_info_async_completed_tail = &runtime_info_async_completed;
+
+	pthread_mutex_unlock(&runtime_info_async_mutex);
+
+	while (requests != NULL)
+	{
+		request = requests;
+		requests = request->next;
+
+		request->callback(request->key, request->result, &request->value, request->user_data);
+
+		if (request->result == RUNTIME_INFO_ERROR_NONE && request->data_type == RUNTIME_INFO_DATA_TYPE_STRING)
+		{
+			free(request->value.s);
+		}
+
+		free(request);
+	}
+}
+
+static void *runtime_info_async_thread(void *data)
+{
+	runtime_info_async_request_h requests;
+	runtime_info_async_request_h *requests_tail;
+
+	pthread_mutex_lock(&runtime_info_async_mutex);
+
+	while (1)
+	{
+		while (runtime_info_async_pending == NULL)
+		{
+			pthread_cond_wait(&runtime_info_async_cond, &runtime_info_async_mutex);
+		}
+
+		requests = runtime_info_async_pending;
+		requests_tail = runtime_info_async_pending_tail;
+		runtime_info_async_pending = NULL;
+		runtime_info_async_pending_tail = &runtime_info_async_pending;
+
+		pthread_mutex_unlock(&runtime_info_async_mutex);
+
+		runtime_info_async_read(requests);
+
+		pthread_mutex_lock(&runtime_info_async_mutex);
+
+		*runtime_info_async_completed_tail = requests;
+		runtime_info_async_completed_tail = requests_tail;
+
+		pthread_mutex_unlock(&runtime_info_async_mutex);
+
+		/* in direct mode the completions are delivered from this thread */
+		if (runtime_info_dispatch_wake() == false)
+		{
+			runtime_info_async_complete();
+		}
+
+		pthread_mutex_lock(&runtime_info_async_mutex);
+	}
+
+	return NULL;
+}
+
+static int runtime_info_async_start(void)
+{
+	pthread_t thread;
+
+	if (pthread_create(&thread, NULL, runtime_info_async_thread, NULL))
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to start the read thread", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	pthread_detach(thread);
+
+	runtime_info_async_started = true;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_get_values_async(const runtime_info_key_e *keys, int count, runtime_info_get_value_cb callback, void *user_data)
+{
+	runtime_info_async_request_h requests = NULL;
+	runtime_info_async_request_h *requests_tail = &requests;
+	runtime_info_async_request_h request;
+	runtime_info_data_type_e data_type;
+	int retcode = RUNTIME_INFO_ERROR_NONE;
+	int index;
+
+	if (keys == NULL || count <= 0 || callback == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	for (index = 0; index < count; index++)
+	{
+		if (runtime_info_get_data_type(keys[index], &data_type))
+		{
+			LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+			retcode = RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+			break;
+		}
+
+		request = calloc(1, sizeof(runtime_info_async_request_s));
+
+		if (request == NULL)
+		{
+			LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
+			retcode = RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
+			break;
+		}
+
+		request->key = keys[index];
+		request->data_type = data_type;
+		request->callback = callback;
+		request->user_data = user_data;
+
+		*requests_tail = request;
+		requests_tail = &request->next;
+	}
+
+	pthread_mutex_lock(&runtime_info_async_mutex);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE && runtime_info_async_started == false)
+	{
+		retcode = runtime_info_async_start();
+	}
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*runtime_info_async_pending_tail = requests;
+		runtime_info_async_pending_tail = requests_tail;
+		requests = NULL;
+
+		pthread_cond_signal(&runtime_info_async_cond);
+	}
+
+	pthread_mutex_unlock(&runtime_info_async_mutex);
+
+	while (requests != NULL)
+	{
+		request = requests;
+		requests = request->next;
+		free(request);
+	}
+
+	return retcode;
+}
+
+int runtime_info_get_value_async(runtime_info_key_e key, runtime_info_get_value_cb callback, void *user_data)
+{
+	return runtime_info_get_values_async(&key, 1, callback, user_data);
+}
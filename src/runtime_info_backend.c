@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+/* the first entry is the default backend */
+static runtime_info_backend_h runtime_info_backends[] = {
+	&runtime_info_backend_vconf,
+};
+
+static runtime_info_backend_h runtime_info_backend;
+static pthread_once_t runtime_info_backend_once = PTHREAD_ONCE_INIT;
+
+/*
+ * The backend is selected once, on first use, by name from the RUNTIME_INFO_BACKEND environment variable.
+ */
+static void runtime_info_backend_init(void)
+{
+	const char *name = getenv("RUNTIME_INFO_BACKEND");
+	int index;
+
+	runtime_info_backend = runtime_info_backends[0];
+
+	if (name == NULL)
+	{
+		return;
+	}
+
+	for (index = 0; index < sizeof(runtime_info_backends) / sizeof(runtime_info_backends[0]); index++)
+	{
+		if (!strcmp(runtime_info_backends[index]->name, name))
+		{
+			runtime_info_backend = runtime_info_backends[index];
+			return;
+		}
+	}
+
+	LOGE("[%s] INVALID_PARAMETER(0x%08x) : unknown backend %s, using %s", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER, name, runtime_info_backend->name);
+}
+
+runtime_info_backend_h runtime_info_get_backend(void)
+{
+	pthread_once(&runtime_info_backend_once, runtime_info_backend_init);
+
+	return runtime_info_backend;
+}
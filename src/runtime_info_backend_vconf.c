@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+static int runtime_info_backend_vconf_get_int(const char *key, int *value)
+{
+	return vconf_get_int(key, value);
+}
+
+static int runtime_info_backend_vconf_get_bool(const char *key, bool *value)
+{
+	int vconf_value;
+	int retcode;
+
+	retcode = vconf_get_bool(key, &vconf_value);
+
+	if (retcode == 0)
+	{
+		*value = vconf_value ? true : false;
+	}
+
+	return retcode;
+}
+
+static int runtime_info_backend_vconf_get_double(const char *key, double *value)
+{
+	return vconf_get_dbl(key, value);
+}
+
+static int runtime_info_backend_vconf_get_string(const char *key, char **value)
+{
+	char *str_value = vconf_get_str(key);
+
+	if (str_value == NULL)
+	{
+		return -1;
+	}
+
+	*value = str_value;
+
+	return 0;
+}
+
+static void runtime_info_backend_vconf_event_cb(keynode_t *node, void *event_data)
+{
+	if (node == NULL)
+	{
+		return;
+	}
+
+	runtime_info_backend_changed(event_data);
+}
+
+static int runtime_info_backend_vconf_watch(const char *key, void *data)
+{
+	return vconf_notify_key_changed(key, runtime_info_backend_vconf_event_cb, data);
+}
+
+static void runtime_info_backend_vconf_unwatch(const char *key)
+{
+	vconf_ignore_key_changed(key, runtime_info_backend_vconf_event_cb);
+}
+
+const runtime_info_backend_s runtime_info_backend_vconf = {
+	.name = "vconf",
+	.get_int = runtime_info_backend_vconf_get_int,
+	.get_bool = runtime_info_backend_vconf_get_bool,
+	.get_double = runtime_info_backend_vconf_get_double,
+	.get_string = runtime_info_backend_vconf_get_string,
+	.watch = runtime_info_backend_vconf_watch,
+	.unwatch = runtime_info_backend_vconf_unwatch,
+};
@@ -72,12 +72,12 @@ int runtime_info_wifi_status_get_value(runtime_info_value_h value)
 
 int runtime_info_wifi_status_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_WIFI_STATUS, RUNTIME_INFO_KEY_WIFI_STATUS, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_WIFI_STATUS, RUNTIME_INFO_KEY_WIFI_STATUS);
 }
 
 void runtime_info_wifi_status_unset_event_cb ()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_WIFI_STATUS, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_WIFI_STATUS, RUNTIME_INFO_KEY_WIFI_STATUS);
 }
 
 int runtime_info_bt_enabled_get_value(runtime_info_value_h value)
@@ -110,12 +110,12 @@ int runtime_info_bt_enabled_get_value(runtime_info_value_h value)
 
 int runtime_info_bt_enabled_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_BT_ENABLED, RUNTIME_INFO_KEY_BLUETOOTH_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_BT_ENABLED, RUNTIME_INFO_KEY_BLUETOOTH_ENABLED);
 }
 
 void runtime_info_bt_enabled_unset_event_cb ()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_BT_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_BT_ENABLED, RUNTIME_INFO_KEY_BLUETOOTH_ENABLED);
 }
 
 
@@ -135,12 +135,12 @@ int runtime_info_wifi_hotspot_get_value(runtime_info_value_h value)
 
 int runtime_info_wifi_hotspot_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_WIFI_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_WIFI_HOTSPOT_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_WIFI_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_WIFI_HOTSPOT_ENABLED);
 }
 
 void runtime_info_wifi_hotspot_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_WIFI_HOTSPOT_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_WIFI_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_WIFI_HOTSPOT_ENABLED);
 }
 
 int runtime_info_bt_hotspot_get_value(runtime_info_value_h value)
@@ -159,12 +159,12 @@ int runtime_info_bt_hotspot_get_value(runtime_info_value_h value)
 
 int runtime_info_bt_hotspot_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_BT_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_BLUETOOTH_TETHERING_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_BT_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_BLUETOOTH_TETHERING_ENABLED);
 }
 
 void runtime_info_bt_hotspot_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_BT_HOTSPOT_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_BT_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_BLUETOOTH_TETHERING_ENABLED);
 }
 
 int runtime_info_usb_hotspot_get_value(runtime_info_value_h value)
@@ -183,12 +183,12 @@ int runtime_info_usb_hotspot_get_value(runtime_info_value_h value)
 
 int runtime_info_usb_hotspot_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_USB_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_USB_TETHERING_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_USB_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_USB_TETHERING_ENABLED);
 }
 
 void runtime_info_usb_hotspot_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_USB_HOTSPOT_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_USB_HOTSPOT_ENABLED, RUNTIME_INFO_KEY_USB_TETHERING_ENABLED);
 }
 
 int runtime_info_packet_data_get_value(runtime_info_value_h value)
@@ -207,12 +207,12 @@ int runtime_info_packet_data_get_value(runtime_info_value_h value)
 
 int runtime_info_packet_data_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_PACKET_DATA_ENABLED, RUNTIME_INFO_KEY_PACKET_DATA_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_PACKET_DATA_ENABLED, RUNTIME_INFO_KEY_PACKET_DATA_ENABLED);
 }
 
 void runtime_info_packet_data_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_PACKET_DATA_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_PACKET_DATA_ENABLED, RUNTIME_INFO_KEY_PACKET_DATA_ENABLED);
 }
 
 int runtime_info_data_roaming_get_value(runtime_info_value_h value)
@@ -231,12 +231,12 @@ int runtime_info_data_roaming_get_value(runtime_info_value_h value)
 
 int runtime_info_data_roaming_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_DATA_ROAMING_ENABLED, RUNTIME_INFO_KEY_DATA_ROAMING_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_DATA_ROAMING_ENABLED, RUNTIME_INFO_KEY_DATA_ROAMING_ENABLED);
 }
 
 void runtime_info_data_roaming_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_DATA_ROAMING_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_DATA_ROAMING_ENABLED, RUNTIME_INFO_KEY_DATA_ROAMING_ENABLED);
 }
 
 int runtime_info_gps_status_get_value(runtime_info_value_h value)
@@ -271,11 +271,11 @@ int runtime_info_gps_status_get_value(runtime_info_value_h value)
 
 int runtime_info_gps_status_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_GPS_STATUS, RUNTIME_INFO_KEY_GPS_STATUS, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_GPS_STATUS, RUNTIME_INFO_KEY_GPS_STATUS);
 }
 
 void runtime_info_gps_status_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_GPS_STATUS, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_GPS_STATUS, RUNTIME_INFO_KEY_GPS_STATUS);
 }
 
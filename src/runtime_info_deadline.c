@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+#define RUNTIME_INFO_DEADLINE_WORKERS_MAX 4
+
+/*
+ * A read of the system made by a worker thread for the readers bounded by a deadline.
+ * A key has at most one read in flight, which the readers of the key share, so a stalled key occupies
+ * a single worker and the reads of the other keys keep being served by the other workers.
+ * A reader that misses its deadline leaves before the read completes: the worker and each waiting reader
+ * hold a reference, and the last one frees the read. All fields are guarded by runtime_info_deadline_mutex.
+ */
+typedef struct runtime_info_deadline_read_s {
+	struct runtime_info_deadline_read_s *next;
+	pthread_cond_t cond;
+	int ref_count;
+	bool completed;
+	int result;
+	runtime_info_key_e key;
+	runtime_info_data_type_e data_type;
+	runtime_info_value_u value;
+} runtime_info_deadline_read_s;
+
+typedef runtime_info_deadline_read_s *runtime_info_deadline_read_h;
+
+static pthread_mutex_t runtime_info_deadline_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t runtime_info_deadline_cond = PTHREAD_COND_INITIALIZER;
+static runtime_info_deadline_read_h runtime_info_deadline_pending = NULL;
+static runtime_info_deadline_read_h *runtime_info_deadline_pending_tail = &runtime_info_deadline_pending;
+static runtime_info_deadline_read_h runtime_info_deadline_in_flight[RUNTIME_INFO_KEY_COUNT];
+static int runtime_info_deadline_workers = 0;
+static int runtime_info_deadline_idle_workers = 0;
+
+/* called with runtime_info_deadline_mutex held */
+static void runtime_info_deadline_read_release(runtime_info_deadline_read_h read)
+{
+	if (--read->ref_count != 0)
+	{
+		return;
+	}
+
+	if (read->completed == true && read->result == RUNTIME_INFO_ERROR_NONE)
+	{
+		runtime_info_free_value(read->data_type, &read->value);
+	}
+
+	pthread_cond_destroy(&read->cond);
+	free(read);
+}
+
+static void *runtime_info_deadline_thread(void *data)
+{
+	runtime_info_deadline_read_h read;
+	runtime_info_value_u value;
+	int result;
+
+	pthread_mutex_lock(&runtime_info_deadline_mutex);
+
+	while (1)
+	{
+		while (runtime_info_deadline_pending == NULL)
+		{
+			runtime_info_deadline_idle_workers++;
+			pthread_cond_wait(&runtime_info_deadline_cond, &runtime_info_deadline_mutex);
+			runtime_info_deadline_idle_workers--;
+		}
+
+		read = runtime_info_deadline_pending;
+		runtime_info_deadline_pending = read->next;
+
+		if (runtime_info_deadline_pending == NULL)
+		{
+			runtime_info_deadline_pending_tail = &runtime_info_deadline_pending;
+		}
+
+		pthread_mutex_unlock(&runtime_info_deadline_mutex);
+
+		/* also refreshes the last known good value, even when every reader has given up */
+		memset(&value, 0, sizeof(runtime_info_value_u));
+		result = runtime_info_get_value(read->key, read->data_type, &value);
+
+		pthread_mutex_lock(&runtime_info_deadline_mutex);
+
+		read->value = value;
+		read->result = result;
+		read->completed = true;
+		runtime_info_deadline_in_flight[read->key] = NULL;
+		pthread_cond_broadcast(&read->cond);
+
+		runtime_info_deadline_read_release(read);
+	}
+
+	return NULL;
+}
+
+/*
+ * Called with runtime_info_deadline_mutex held once a read is queued.
+ * A worker is added while none is idle, up to RUNTIME_INFO_DEADLINE_WORKERS_MAX.
+ */
+static int runtime_info_deadline_wake_worker(void)
+{
+	pthread_t thread;
+
+	if (runtime_info_deadline_idle_workers > 0 || runtime_info_deadline_workers >= RUNTIME_INFO_DEADLINE_WORKERS_MAX)
+	{
+		pthread_cond_signal(&runtime_info_deadline_cond);
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
+	if (pthread_create(&thread, NULL, runtime_info_deadline_thread, NULL))
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to start a read thread", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return (runtime_info_deadline_workers > 0) ? RUNTIME_INFO_ERROR_NONE : RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	pthread_detach(thread);
+
+	runtime_info_deadline_workers++;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+/* called with runtime_info_deadline_mutex held; joins the read of the key in flight, or queues a new one */
+static int runtime_info_deadline_read_start(runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_deadline_read_h *read)
+{
+	runtime_info_deadline_read_h new_read = runtime_info_deadline_in_flight[key];
+	pthread_condattr_t condattr;
+
+	if (new_read != NULL)
+	{
+		new_read->ref_count++;
+		*read = new_read;
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
+	new_read = calloc(1, sizeof(runtime_info_deadline_read_s));
+
+	if (new_read == NULL)
+	{
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
+		return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	pthread_condattr_init(&condattr);
+	pthread_condattr_setclock(&condattr, CLOCK_MONOTONIC);
+	pthread_cond_init(&new_read->cond, &condattr);
+	pthread_condattr_destroy(&condattr);
+
+	new_read->key = key;
+	new_read->data_type = data_type;
+
+	*runtime_info_deadline_pending_tail = new_read;
+	runtime_info_deadline_pending_tail = &new_read->next;
+
+	if (runtime_info_deadline_wake_worker() != RUNTIME_INFO_ERROR_NONE)
+	{
+		/* with no worker at all, nothing else can be queued */
+		runtime_info_deadline_pending = NULL;
+		runtime_info_deadline_pending_tail = &runtime_info_deadline_pending;
+		pthread_cond_destroy(&new_read->cond);
+		free(new_read);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	/* one reference for the worker, one for the reader */
+	new_read->ref_count = 2;
+	runtime_info_deadline_in_flight[key] = new_read;
+	*read = new_read;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+static int runtime_info_deadline_read(runtime_info_key_e key, runtime_info_data_type_e data_type, int timeout_ms, runtime_info_value_h value)
+{
+	runtime_info_deadline_read_h read;
+	unsigned long long deadline_ns;
+	struct timespec timeout;
+	int retcode;
+
+	deadline_ns = runtime_info_get_monotonic_ns() + (unsigned long long)timeout_ms * 1000000ULL;
+	timeout.tv_sec = deadline_ns / 1000000000ULL;
+	timeout.tv_nsec = deadline_ns % 1000000000ULL;
+
+	pthread_mutex_lock(&runtime_info_deadline_mutex);
+
+	retcode = runtime_info_deadline_read_start(key, data_type, &read);
+
+	if (retcode != RUNTIME_INFO_ERROR_NONE)
+	{
+		pthread_mutex_unlock(&runtime_info_deadline_mutex);
+		return retcode;
+	}
+
+	while (read->completed == false)
+	{
+		if (timeout_ms < 0)
+		{
+			pthread_cond_wait(&read->cond, &runtime_info_deadline_mutex);
+		}
+		else if (pthread_cond_timedwait(&read->cond, &runtime_info_deadline_mutex, &timeout))
+		{
+			break;
+		}
+	}
+
+	if (read->completed == false)
+	{
+		retcode = RUNTIME_INFO_ERROR_TIMED_OUT;
+	}
+	else if (read->result == RUNTIME_INFO_ERROR_NONE)
+	{
+		/* the readers that shared the read each get their own copy */
+		retcode = runtime_info_copy_value(data_type, value, &read->value);
+	}
+	else
+	{
+		retcode = read->result;
+	}
+
+	runtime_info_deadline_read_release(read);
+
+	pthread_mutex_unlock(&runtime_info_deadline_mutex);
+
+	return retcode;
+}
+
+static int runtime_info_get_value_timed(runtime_info_key_e key, runtime_info_data_type_e data_type, int timeout_ms, runtime_info_stale_policy_e policy, runtime_info_value_h value, unsigned int *age_ms)
+{
+	runtime_info_data_type_e key_data_type;
+	unsigned long long updated_us;
+	int retcode;
+
+	if (runtime_info_get_data_type(key, &key_data_type) || key_data_type != data_type)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (policy != RUNTIME_INFO_STALE_POLICY_NONE && policy != RUNTIME_INFO_STALE_POLICY_LAST_KNOWN_GOOD)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid policy", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_get_local_value(key, data_type, value);
+
+	if (retcode == RUNTIME_INFO_ERROR_IO_ERROR)
+	{
+		retcode = runtime_info_deadline_read(key, data_type, timeout_ms, value);
+	}
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		updated_us = 0;
+	}
+	else if (retcode != RUNTIME_INFO_ERROR_OUT_OF_MEMORY && policy == RUNTIME_INFO_STALE_POLICY_LAST_KNOWN_GOOD
+		&& runtime_info_get_last_known_good_value(key, value, &updated_us) == RUNTIME_INFO_ERROR_NONE)
+	{
+		LOGI("[%s] serving the last known value of key(%d) : %s", __FUNCTION__, key,
+			retcode == RUNTIME_INFO_ERROR_TIMED_OUT ? "timed out" : "read failed");
+		retcode = RUNTIME_INFO_ERROR_NONE;
+	}
+	else
+	{
+		LOGE("[%s] failed to get the runtime information / key(%d) error(0x%08x)", __FUNCTION__, key, retcode);
+		return retcode;
+	}
+
+	if (age_ms != NULL)
+	{
+		*age_ms = (updated_us == 0) ? 0 : (unsigned int)((runtime_info_get_monotonic_us() - updated_us) / 1000);
+	}
+
+	return retcode;
+}
+
+int runtime_info_get_value_int_timed(runtime_info_key_e key, int timeout_ms, runtime_info_stale_policy_e policy, int *value, unsigned int *age_ms)
+{
+	runtime_info_value_u runtime_info_value;
+	int retcode;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_get_value_timed(key, RUNTIME_INFO_DATA_TYPE_INT, timeout_ms, policy, &runtime_info_value, age_ms);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*value = runtime_info_value.i;
+	}
+
+	return retcode;
+}
+
+int runtime_info_get_value_bool_timed(runtime_info_key_e key, int timeout_ms, runtime_info_stale_policy_e policy, bool *value, unsigned int *age_ms)
+{
+	runtime_info_value_u runtime_info_value;
+	int retcode;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_get_value_timed(key, RUNTIME_INFO_DATA_TYPE_BOOL, timeout_ms, policy, &runtime_info_value, age_ms);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*value = runtime_info_value.b;
+	}
+
+	return retcode;
+}
+
+int runtime_info_get_value_double_timed(runtime_info_key_e key, int timeout_ms, runtime_info_stale_policy_e policy, double *value, unsigned int *age_ms)
+{
+	runtime_info_value_u runtime_info_value;
+	int retcode;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_get_value_timed(key, RUNTIME_INFO_DATA_TYPE_DOUBLE, timeout_ms, policy, &runtime_info_value, age_ms);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*value = runtime_info_value.d;
+	}
+
+	return retcode;
+}
+
+int runtime_info_get_value_string_timed(runtime_info_key_e key, int timeout_ms, runtime_info_stale_policy_e policy, char **value, unsigned int *age_ms)
+{
+	runtime_info_value_u runtime_info_value;
+	int retcode;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_get_value_timed(key, RUNTIME_INFO_DATA_TYPE_STRING, timeout_ms, policy, &runtime_info_value, age_ms);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*value = runtime_info_value.s;
+	}
+
+	return retcode;
+}
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+#define RUNTIME_INFO_DISPATCH_QUEUE_SIZE 64
+#define RUNTIME_INFO_DISPATCH_QUEUE_MASK (RUNTIME_INFO_DISPATCH_QUEUE_SIZE - 1)
+
+/*
+ * Bounded multi-producer single-consumer ring.
+ * A slot is free for the producer claiming position pos when its sequence equals pos,
+ * and holds a key for the consumer when its sequence equals pos + 1.
+ */
+typedef struct {
+	unsigned int sequence;
+	runtime_info_key_e key;
+} runtime_info_dispatch_slot_s;
+
+static runtime_info_dispatch_slot_s runtime_info_dispatch_queue[RUNTIME_INFO_DISPATCH_QUEUE_SIZE];
+static unsigned int runtime_info_dispatch_queue_head = 0;
+static unsigned int runtime_info_dispatch_queue_tail = 0;
+
+/* keys notified while the ring was full, coalesced until the consumer catches up */
+static unsigned long long runtime_info_dispatch_overflow = 0;
+
+static runtime_info_dispatch_mode_e runtime_info_dispatch_mode = RUNTIME_INFO_DISPATCH_MODE_DIRECT;
+static pthread_mutex_t runtime_info_dispatch_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* held for reading from the check of the mode to the enqueue, so that a switch to direct mode sees every queued key */
+static pthread_rwlock_t runtime_info_dispatch_mode_rwlock = PTHREAD_RWLOCK_INITIALIZER;
+static pthread_cond_t runtime_info_dispatch_cond = PTHREAD_COND_INITIALIZER;
+static pthread_mutex_t runtime_info_dispatch_drain_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool runtime_info_dispatch_started = false;
+static bool runtime_info_dispatch_signaled = false;
+static int runtime_info_dispatch_fd = -1;
+static __thread bool runtime_info_dispatch_draining;
+
+static bool runtime_info_dispatch_queue_enqueue(runtime_info_key_e key)
+{
+	runtime_info_dispatch_slot_s *slot;
+	unsigned int pos = __atomic_load_n(&runtime_info_dispatch_queue_head, __ATOMIC_RELAXED);
+	int diff;
+
+	while (1)
+	{
+		slot = &runtime_info_dispatch_queue[pos & RUNTIME_INFO_DISPATCH_QUEUE_MASK];
+		diff = (int)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - pos);
+
+		if (diff == 0)
+		{
+			if (__atomic_compare_exchange_n(&runtime_info_dispatch_queue_head, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			{
+				break;
+			}
+		}
+		else if (diff < 0)
+		{
+			return false;
+		}
+		else
+		{
+			pos = __atomic_load_n(&runtime_info_dispatch_queue_head, __ATOMIC_RELAXED);
+		}
+	}
+
+	slot->key = key;
+	__atomic_store_n(&slot->sequence, pos + 1, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+static bool runtime_info_dispatch_queue_dequeue(runtime_info_key_e *key)
+{
+	unsigned int pos = runtime_info_dispatch_queue_tail;
+	runtime_info_dispatch_slot_s *slot = &runtime_info_dispatch_queue[pos & RUNTIME_INFO_DISPATCH_QUEUE_MASK];
+
+	if ((int)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - (pos + 1)) < 0)
+	{
+		return false;
+	}
+
+	*key = slot->key;
+	__atomic_store_n(&slot->sequence, pos + RUNTIME_INFO_DISPATCH_QUEUE_SIZE, __ATOMIC_RELEASE);
+	runtime_info_dispatch_queue_tail = pos + 1;
+
+	return true;
+}
+
+static void runtime_info_dispatch_signal(void)
+{
+	uint64_t count = 1;
+
+	/* the consumer is only woken up once per drain, whatever the number of notifications */
+	if (__atomic_exchange_n(&runtime_info_dispatch_signaled, true, __ATOMIC_ACQ_REL) == false)
+	{
+		if (write(runtime_info_dispatch_fd, &count, sizeof(count)) != sizeof(count))
+		{
+			LOGE("[%s] IO_ERROR(0x%08x) : failed to wake up the dispatch thread", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		}
+	}
+}
+
+bool runtime_info_dispatch_queue_push(runtime_info_key_e key)
+{
+	pthread_rwlock_rdlock(&runtime_info_dispatch_mode_rwlock);
+
+	if (__atomic_load_n(&runtime_info_dispatch_mode, __ATOMIC_ACQUIRE) == RUNTIME_INFO_DISPATCH_MODE_DIRECT)
+	{
+		pthread_rwlock_unlock(&runtime_info_dispatch_mode_rwlock);
+		return false;
+	}
+
+	if (runtime_info_dispatch_queue_enqueue(key) == false
+		&& (__atomic_fetch_or(&runtime_info_dispatch_overflow, RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE) & RUNTIME_INFO_KEY_BIT(key)))
+	{
+		RUNTIME_INFO_STATS_COUNT(key, duplicates_suppressed);
+	}
+
+	pthread_rwlock_unlock(&runtime_info_dispatch_mode_rwlock);
+
+	runtime_info_dispatch_signal();
+
+	return true;
+}
+
+/*
+ * Requests a drain for work queued outside of the ring, such as the completions of asynchronous reads.
+ * Returns false in direct mode, where the caller runs that work itself.
+ */
+bool runtime_info_dispatch_wake(void)
+{
+	if (__atomic_load_n(&runtime_info_dispatch_mode, __ATOMIC_ACQUIRE) == RUNTIME_INFO_DISPATCH_MODE_DIRECT)
+	{
+		return false;
+	}
+
+	runtime_info_dispatch_signal();
+
+	return true;
+}
+
+/*
+ * Dispatches every key queued before the drain started, each at most once and in the order of its first notification.
+ * The value is read when the key is dispatched, so the callbacks always observe the latest one;
+ * a key queued again once the drain started is left to the next drain, which the producer has signaled.
+ * The asynchronous reads completed so far are delivered last.
+ * In direct mode nothing else drains the ring, so the drain then goes on until it is empty:
+ * a callback may have switched to direct mode after the keys it left were queued.
+ * Called with runtime_info_dispatch_drain_mutex held, which keeps a single consumer on the ring.
+ */
+static void runtime_info_dispatch_queue_drain(void)
+{
+	unsigned long long dispatched = 0;
+	unsigned long long overflow;
+	runtime_info_key_e key;
+	unsigned int head;
+	uint64_t count;
+	int index;
+
+	runtime_info_dispatch_draining = true;
+
+again:
+	/* resets the wake-up counter, which is already zero when nothing was signaled since the last drain */
+	if (read(runtime_info_dispatch_fd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to read the dispatch event", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+	}
+
+	__atomic_store_n(&runtime_info_dispatch_signaled, false, __ATOMIC_SEQ_CST);
+
+	head = __atomic_load_n(&runtime_info_dispatch_queue_head, __ATOMIC_SEQ_CST);
+	overflow = __atomic_exchange_n(&runtime_info_dispatch_overflow, 0, __ATOMIC_ACQ_REL);
+
+	while ((int)(head - runtime_info_dispatch_queue_tail) > 0 && runtime_info_dispatch_queue_dequeue(&key) == true)
+	{
+		if (!(dispatched & RUNTIME_INFO_KEY_BIT(key)))
+		{
+			dispatched |= RUNTIME_INFO_KEY_BIT(key);
+			runtime_info_dispatch(key);
+		}
+		else
+		{
+			RUNTIME_INFO_STATS_COUNT(key, duplicates_suppressed);
+		}
+	}
+
+	overflow &= ~dispatched;
+
+	for (index = 0; overflow != 0 && index < RUNTIME_INFO_KEY_COUNT; index++)
+	{
+		if (overflow & RUNTIME_INFO_KEY_BIT(index))
+		{
+			overflow &= ~RUNTIME_INFO_KEY_BIT(index);
+			runtime_info_dispatch(index);
+		}
+	}
+
+	runtime_info_async_complete();
+
+	if (__atomic_load_n(&runtime_info_dispatch_mode, __ATOMIC_ACQUIRE) == RUNTIME_INFO_DISPATCH_MODE_DIRECT
+		&& (__atomic_load_n(&runtime_info_dispatch_queue_head, __ATOMIC_ACQUIRE) != runtime_info_dispatch_queue_tail
+		|| __atomic_load_n(&runtime_info_dispatch_overflow, __ATOMIC_ACQUIRE) != 0))
+	{
+		dispatched = 0;
+		goto again;
+	}
+
+	runtime_info_dispatch_draining = false;
+}
+
+static void *runtime_info_dispatch_thread(void *data)
+{
+	struct pollfd pollfd = { .fd = runtime_info_dispatch_fd, .events = POLLIN };
+
+	while (1)
+	{
+		if (poll(&pollfd, 1, -1) <= 0)
+		{
+			continue;
+		}
+
+		/* in event fd mode the queue belongs to the caller of runtime_info_process_events() */
+		pthread_mutex_lock(&runtime_info_dispatch_mutex);
+
+		while (runtime_info_dispatch_mode == RUNTIME_INFO_DISPATCH_MODE_EVENT_FD)
+		{
+			pthread_cond_wait(&runtime_info_dispatch_cond, &runtime_info_dispatch_mutex);
+		}
+
+		pthread_mutex_unlock(&runtime_info_dispatch_mutex);
+
+		pthread_mutex_lock(&runtime_info_dispatch_drain_mutex);
+		runtime_info_dispatch_queue_drain();
+		pthread_mutex_unlock(&runtime_info_dispatch_drain_mutex);
+	}
+
+	return NULL;
+}
+
+static int runtime_info_dispatch_open(void)
+{
+	int index;
+
+	if (runtime_info_dispatch_fd >= 0)
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
+	for (index = 0; index < RUNTIME_INFO_DISPATCH_QUEUE_SIZE; index++)
+	{
+		runtime_info_dispatch_queue[index].sequence = index;
+	}
+
+	__atomic_store_n(&runtime_info_dispatch_fd, eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK), __ATOMIC_RELEASE);
+
+	if (runtime_info_dispatch_fd < 0)
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to create the event fd", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+static int runtime_info_dispatch_start(void)
+{
+	pthread_t thread;
+
+	if (pthread_create(&thread, NULL, runtime_info_dispatch_thread, NULL))
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to start the dispatch thread", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	pthread_detach(thread);
+
+	runtime_info_dispatch_started = true;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_set_dispatch_mode(runtime_info_dispatch_mode_e mode)
+{
+	runtime_info_dispatch_mode_e previous_mode;
+	int retcode = RUNTIME_INFO_ERROR_NONE;
+
+	if (mode != RUNTIME_INFO_DISPATCH_MODE_DIRECT && mode != RUNTIME_INFO_DISPATCH_MODE_THREAD
+		&& mode != RUNTIME_INFO_DISPATCH_MODE_EVENT_FD)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid dispatch mode", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_mutex_lock(&runtime_info_dispatch_mutex);
+
+	previous_mode = runtime_info_dispatch_mode;
+
+	if (mode != RUNTIME_INFO_DISPATCH_MODE_DIRECT)
+	{
+		retcode = runtime_info_dispatch_open();
+	}
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE && mode == RUNTIME_INFO_DISPATCH_MODE_THREAD && runtime_info_dispatch_started == false)
+	{
+		retcode = runtime_info_dispatch_start();
+	}
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		pthread_rwlock_wrlock(&runtime_info_dispatch_mode_rwlock);
+		__atomic_store_n(&runtime_info_dispatch_mode, mode, __ATOMIC_RELEASE);
+		pthread_rwlock_unlock(&runtime_info_dispatch_mode_rwlock);
+
+		pthread_cond_broadcast(&runtime_info_dispatch_cond);
+	}
+
+	pthread_mutex_unlock(&runtime_info_dispatch_mutex);
+
+	/*
+	 * Nobody calls runtime_info_process_events() any more, so the events it left queued are delivered now.
+	 * The drain waits for one in progress on another thread, which may have started before the last keys were queued;
+	 * a drain of this thread, from which a callback switched the mode, goes on by itself.
+	 */
+	if (retcode == RUNTIME_INFO_ERROR_NONE && previous_mode == RUNTIME_INFO_DISPATCH_MODE_EVENT_FD
+		&& mode == RUNTIME_INFO_DISPATCH_MODE_DIRECT && runtime_info_dispatch_draining == false)
+	{
+		pthread_mutex_lock(&runtime_info_dispatch_drain_mutex);
+		runtime_info_dispatch_queue_drain();
+		pthread_mutex_unlock(&runtime_info_dispatch_drain_mutex);
+	}
+
+	return retcode;
+}
+
+int runtime_info_get_event_fd(int *fd)
+{
+	int retcode;
+
+	if (fd == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_set_dispatch_mode(RUNTIME_INFO_DISPATCH_MODE_EVENT_FD);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*fd = runtime_info_dispatch_fd;
+	}
+
+	return retcode;
+}
+
+int runtime_info_process_events(void)
+{
+	if (__atomic_load_n(&runtime_info_dispatch_fd, __ATOMIC_ACQUIRE) < 0)
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
+	/* a drain already in progress, possibly the caller's own, dispatches whatever is queued */
+	if (pthread_mutex_trylock(&runtime_info_dispatch_drain_mutex))
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
+	runtime_info_dispatch_queue_drain();
+
+	pthread_mutex_unlock(&runtime_info_dispatch_drain_mutex);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
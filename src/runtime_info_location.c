@@ -51,12 +51,12 @@ int runtime_info_location_service_get_value(runtime_info_value_h value)
 
 int runtime_info_location_service_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_LOCATION_SERVICE_ENABLED, RUNTIME_INFO_KEY_LOCATION_SERVICE_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_LOCATION_SERVICE_ENABLED, RUNTIME_INFO_KEY_LOCATION_SERVICE_ENABLED);
 }
 
 void runtime_info_location_service_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_LOCATION_SERVICE_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_LOCATION_SERVICE_ENABLED, RUNTIME_INFO_KEY_LOCATION_SERVICE_ENABLED);
 }
 
 int runtime_info_location_agps_get_value(runtime_info_value_h value)
@@ -75,12 +75,12 @@ int runtime_info_location_agps_get_value(runtime_info_value_h value)
 
 int runtime_info_location_agps_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_LOCATION_AGPS_ENABLED, RUNTIME_INFO_KEY_LOCATION_ADVANCED_GPS_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_LOCATION_AGPS_ENABLED, RUNTIME_INFO_KEY_LOCATION_ADVANCED_GPS_ENABLED);
 }
 
 void runtime_info_location_agps_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_LOCATION_AGPS_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_LOCATION_AGPS_ENABLED, RUNTIME_INFO_KEY_LOCATION_ADVANCED_GPS_ENABLED);
 }
 
 int runtime_info_location_network_get_value(runtime_info_value_h value)
@@ -99,12 +99,12 @@ int runtime_info_location_network_get_value(runtime_info_value_h value)
 
 int runtime_info_location_network_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_LOCATION_NETWORK_ENABLED, RUNTIME_INFO_KEY_LOCATION_NETWORK_POSITION_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_LOCATION_NETWORK_ENABLED, RUNTIME_INFO_KEY_LOCATION_NETWORK_POSITION_ENABLED);
 }
 
 void runtime_info_location_network_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_LOCATION_NETWORK_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_LOCATION_NETWORK_ENABLED, RUNTIME_INFO_KEY_LOCATION_NETWORK_POSITION_ENABLED);
 }
 
 int runtime_info_location_sensor_get_value(runtime_info_value_h value)
@@ -123,11 +123,11 @@ int runtime_info_location_sensor_get_value(runtime_info_value_h value)
 
 int runtime_info_location_sensor_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_LOCATION_SENSOR_ENABLED, RUNTIME_INFO_KEY_LOCATION_SENSOR_AIDING_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_LOCATION_SENSOR_ENABLED, RUNTIME_INFO_KEY_LOCATION_SENSOR_AIDING_ENABLED);
 }
 
 void runtime_info_location_sensor_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_LOCATION_SENSOR_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_LOCATION_SENSOR_ENABLED, RUNTIME_INFO_KEY_LOCATION_SENSOR_AIDING_ENABLED);
 }
 
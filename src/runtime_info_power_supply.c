@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+#define RUNTIME_INFO_POWER_SUPPLY_MAX 8
+#define RUNTIME_INFO_POWER_SUPPLY_ATTRIBUTE_SIZE 32
+
+/*
+ * Reads the power supply class of the kernel directly, instead of the copy a daemon keeps in vconf.
+ * The source is enabled by setting the RUNTIME_INFO_POWER_SUPPLY environment variable to the class directory,
+ * normally /sys/class/power_supply; any directory laid out the same way can be used in its place,
+ * and runtime_info_power_supply_set_root() switches to another one at run time.
+ * The attributes are opened once and read with pread(), which makes sysfs produce the current value each time.
+ */
+typedef struct {
+	bool battery;
+	int fd; /* status of a battery, online of any other supply */
+} runtime_info_power_supply_s;
+
+static runtime_info_power_supply_s runtime_info_power_supplies[RUNTIME_INFO_POWER_SUPPLY_MAX];
+static int runtime_info_power_supply_count;
+static bool runtime_info_power_supply_initialized = false;
+static pthread_mutex_t runtime_info_power_supply_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int runtime_info_power_supply_read(int fd, char *buffer)
+{
+	ssize_t length = pread(fd, buffer, RUNTIME_INFO_POWER_SUPPLY_ATTRIBUTE_SIZE - 1, 0);
+
+	if (length < 0)
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	while (length > 0 && (buffer[length - 1] == '\n' || buffer[length - 1] == ' '))
+	{
+		length--;
+	}
+
+	buffer[length] = '\0';
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+static int runtime_info_power_supply_open(const char *root, const char *supply, const char *attribute)
+{
+	char path[256];
+
+	if (snprintf(path, sizeof(path), "%s/%s/%s", root, supply, attribute) >= sizeof(path))
+	{
+		return -1;
+	}
+
+	return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+static void runtime_info_power_supply_add(const char *root, const char *supply)
+{
+	runtime_info_power_supply_s *power_supply = &runtime_info_power_supplies[runtime_info_power_supply_count];
+	char type[RUNTIME_INFO_POWER_SUPPLY_ATTRIBUTE_SIZE];
+	int fd;
+
+	fd = runtime_info_power_supply_open(root, supply, "type");
+
+	if (fd < 0)
+	{
+		return;
+	}
+
+	if (runtime_info_power_supply_read(fd, type) != RUNTIME_INFO_ERROR_NONE)
+	{
+		close(fd);
+		return;
+	}
+
+	close(fd);
+
+	power_supply->battery = !strcmp(type, "Battery");
+	power_supply->fd = runtime_info_power_supply_open(root, supply, power_supply->battery ? "status" : "online");
+
+	if (power_supply->fd >= 0)
+	{
+		runtime_info_power_supply_count++;
+	}
+}
+
+static void runtime_info_power_supply_scan(const char *root)
+{
+	struct dirent *entry;
+	DIR *dir;
+
+	runtime_info_power_supply_initialized = true;
+
+	if (root == NULL)
+	{
+		return;
+	}
+
+	dir = opendir(root);
+
+	if (dir == NULL)
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to open %s, using vconf", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR, root);
+		return;
+	}
+
+	while ((entry = readdir(dir)) != NULL && runtime_info_power_supply_count < RUNTIME_INFO_POWER_SUPPLY_MAX)
+	{
+		if (entry->d_name[0] != '.')
+		{
+			runtime_info_power_supply_add(root, entry->d_name);
+		}
+	}
+
+	closedir(dir);
+}
+
+static void runtime_info_power_supply_close(void)
+{
+	int index;
+
+	for (index = 0; index < runtime_info_power_supply_count; index++)
+	{
+		close(runtime_info_power_supplies[index].fd);
+	}
+
+	runtime_info_power_supply_count = 0;
+}
+
+/*
+ * Replaces the class directory given by RUNTIME_INFO_POWER_SUPPLY, or disables the source when root is NULL.
+ * The supplies are discovered again from the new directory.
+ */
+void runtime_info_power_supply_set_root(const char *root)
+{
+	pthread_mutex_lock(&runtime_info_power_supply_mutex);
+
+	runtime_info_power_supply_close();
+	runtime_info_power_supply_scan(root);
+
+	pthread_mutex_unlock(&runtime_info_power_supply_mutex);
+}
+
+/*
+ * Returns 1 when a supply of the requested kind reads value, 0 when none does,
+ * and an error when the source is disabled or no supply of that kind could be read.
+ */
+static int runtime_info_power_supply_find(bool battery, const char *value)
+{
+	char buffer[RUNTIME_INFO_POWER_SUPPLY_ATTRIBUTE_SIZE];
+	int retcode = RUNTIME_INFO_ERROR_IO_ERROR;
+	int index;
+
+	pthread_mutex_lock(&runtime_info_power_supply_mutex);
+
+	if (runtime_info_power_supply_initialized == false)
+	{
+		runtime_info_power_supply_scan(getenv("RUNTIME_INFO_POWER_SUPPLY"));
+	}
+
+	for (index = 0; index < runtime_info_power_supply_count; index++)
+	{
+		if (runtime_info_power_supplies[index].battery != battery
+			|| runtime_info_power_supply_read(runtime_info_power_supplies[index].fd, buffer) != RUNTIME_INFO_ERROR_NONE)
+		{
+			continue;
+		}
+
+		if (!strcmp(buffer, value))
+		{
+			retcode = 1;
+			break;
+		}
+
+		retcode = 0;
+	}
+
+	pthread_mutex_unlock(&runtime_info_power_supply_mutex);
+
+	return retcode;
+}
+
+int runtime_info_power_supply_get_battery_charging(bool *charging)
+{
+	int found = runtime_info_power_supply_find(true, "Charging");
+
+	if (found < 0)
+	{
+		return found;
+	}
+
+	*charging = found;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_power_supply_get_charger_connected(bool *connected)
+{
+	int found = runtime_info_power_supply_find(false, "1");
+
+	if (found < 0)
+	{
+		return found;
+	}
+
+	*connected = found;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+#define RUNTIME_INFO_SHM_NAME "/capi-system-runtime-info"
+#define RUNTIME_INFO_SHM_MAGIC 0x52494e46
+#define RUNTIME_INFO_SHM_VERSION 3
+#define RUNTIME_INFO_SHM_STRING_SIZE 64
+#define RUNTIME_INFO_SHM_READ_RETRIES 64
+#define RUNTIME_INFO_SHM_CHECK_INTERVAL_US 1000000ULL
+
+/*
+ * The state page shared by one producer process with any number of consumers.
+ * The layout only uses fixed-size fields, so that 32-bit and 64-bit processes agree on it.
+ * sequence is a seqlock: it is odd while the producer writes, and readers retry when it moved under them.
+ * producer_pid is the process publishing the page, 0 once it stopped.
+ * Consumers stop using the page when its producer is gone.
+ */
+typedef struct {
+	double d;
+	int i;
+	int b;
+	char string[RUNTIME_INFO_SHM_STRING_SIZE];
+} runtime_info_shm_value_s;
+
+typedef struct {
+	unsigned int magic;
+	unsigned int version;
+	unsigned int key_count;
+	unsigned int sequence;
+	int producer_pid;
+	unsigned long long valid;
+	runtime_info_shm_value_s values[RUNTIME_INFO_KEY_COUNT];
+} runtime_info_shm_page_s;
+
+typedef runtime_info_shm_page_s *runtime_info_shm_page_h;
+
+static pthread_mutex_t runtime_info_shm_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* producer side */
+static runtime_info_shm_page_h runtime_info_shm_published;
+static runtime_info_subscription_h runtime_info_shm_subscriptions[RUNTIME_INFO_KEY_COUNT];
+
+/* consumer side */
+static runtime_info_shm_page_h runtime_info_shm_page;
+static bool runtime_info_shm_enabled = false;
+static unsigned long long runtime_info_shm_check_us;
+
+/*
+ * A page is trusted only when it is writable by its owner alone, and owned by the user of this process,
+ * or by root for a consumer: any other process could have created it first to feed forged values.
+ */
+static bool runtime_info_shm_is_trusted(int fd, bool writable)
+{
+	struct stat status;
+
+	if (fstat(fd, &status) < 0)
+	{
+		return false;
+	}
+
+	return S_ISREG(status.st_mode) && (status.st_uid == geteuid() || (writable == false && status.st_uid == 0))
+		&& (status.st_mode & (S_IWGRP | S_IWOTH)) == 0 && status.st_size >= sizeof(runtime_info_shm_page_s);
+}
+
+/*
+ * The producer creates the page, or reuses the one left by a previous producer after checking it owns it.
+ * A consumer maps it read-only once it checked its owner.
+ */
+static runtime_info_shm_page_h runtime_info_shm_map(bool writable)
+{
+	runtime_info_shm_page_h page;
+	int fd;
+
+	if (writable)
+	{
+		fd = shm_open(RUNTIME_INFO_SHM_NAME, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+
+		if (fd >= 0 && ftruncate(fd, sizeof(runtime_info_shm_page_s)) < 0)
+		{
+			close(fd);
+			shm_unlink(RUNTIME_INFO_SHM_NAME);
+			return NULL;
+		}
+
+		if (fd < 0 && errno == EEXIST)
+		{
+			fd = shm_open(RUNTIME_INFO_SHM_NAME, O_RDWR | O_CLOEXEC, 0);
+		}
+	}
+	else
+	{
+		fd = shm_open(RUNTIME_INFO_SHM_NAME, O_RDONLY | O_CLOEXEC, 0);
+	}
+
+	if (fd < 0)
+	{
+		return NULL;
+	}
+
+	if (!runtime_info_shm_is_trusted(fd, writable))
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : the shared state page has an unexpected owner or mode", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		close(fd);
+		return NULL;
+	}
+
+	page = mmap(NULL, sizeof(runtime_info_shm_page_s), writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+
+	close(fd);
+
+	return (page != MAP_FAILED) ? page : NULL;
+}
+
+/* a producer that exited or crashed without unpublishing leaves its pid in the page */
+static bool runtime_info_shm_producer_alive(runtime_info_shm_page_h page)
+{
+	int pid = __atomic_load_n(&page->producer_pid, __ATOMIC_ACQUIRE);
+
+	return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+static void runtime_info_shm_write_begin(runtime_info_shm_page_h page)
+{
+	__atomic_store_n(&page->sequence, page->sequence + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void runtime_info_shm_write_end(runtime_info_shm_page_h page)
+{
+	__atomic_store_n(&page->sequence, page->sequence + 1, __ATOMIC_RELEASE);
+}
+
+/* called with runtime_info_shm_mutex held */
+static void runtime_info_shm_publish_key(runtime_info_shm_page_h page, runtime_info_key_e key)
+{
+	runtime_info_shm_value_s *shm_value = &page->values[key];
+	runtime_info_data_type_e data_type;
+	runtime_info_value_u value;
+	bool valid;
+
+	runtime_info_get_data_type(key, &data_type);
+	memset(&value, 0, sizeof(runtime_info_value_u));
+
+	valid = (runtime_info_get_value(key, data_type, &value) == RUNTIME_INFO_ERROR_NONE);
+
+	/* a string that does not fit is left to the backend of each consumer */
+	if (valid == true && data_type == RUNTIME_INFO_DATA_TYPE_STRING && strlen(value.s) >= RUNTIME_INFO_SHM_STRING_SIZE)
+	{
+		valid = false;
+	}
+
+	runtime_info_shm_write_begin(page);
+
+	if (valid == true)
+	{
+		switch (data_type)
+		{
+		case RUNTIME_INFO_DATA_TYPE_INT:
+			shm_value->i = value.i;
+			break;
+
+		case RUNTIME_INFO_DATA_TYPE_BOOL:
+			shm_value->b = value.b;
+			break;
+
+		case RUNTIME_INFO_DATA_TYPE_DOUBLE:
+			shm_value->d = value.d;
+			break;
+
+		case RUNTIME_INFO_DATA_TYPE_STRING:
+			strcpy(shm_value->string, value.s);
+			break;
+		}
+
+		page->valid |= RUNTIME_INFO_KEY_BIT(key);
+	}
+	else
+	{
+		page->valid &= ~RUNTIME_INFO_KEY_BIT(key);
+	}
+
+	runtime_info_shm_write_end(page);
+
+	runtime_info_free_value(data_type, &value);
+}
+
+/* a callback may still run after the page was unpublished, since unsubscribing does not wait for it */
+static void runtime_info_shm_changed_cb(runtime_info_key_e key, void *user_data)
+{
+	pthread_mutex_lock(&runtime_info_shm_mutex);
+
+	if (runtime_info_shm_published != NULL)
+	{
+		runtime_info_shm_publish_key(runtime_info_shm_published, key);
+	}
+
+	pthread_mutex_unlock(&runtime_info_shm_mutex);
+}
+
+int runtime_info_publish_shared_state(void)
+{
+	runtime_info_subscription_h subscription;
+	runtime_info_shm_page_h page;
+	unsigned int sequence;
+	int key;
+
+	pthread_mutex_lock(&runtime_info_shm_mutex);
+
+	if (runtime_info_shm_published != NULL)
+	{
+		pthread_mutex_unlock(&runtime_info_shm_mutex);
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
+	page = runtime_info_shm_map(true);
+
+	if (page == NULL)
+	{
+		pthread_mutex_unlock(&runtime_info_shm_mutex);
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to create the shared state page", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	if (runtime_info_shm_producer_alive(page))
+	{
+		munmap(page, sizeof(runtime_info_shm_page_s));
+		pthread_mutex_unlock(&runtime_info_shm_mutex);
+		LOGE("[%s] IO_ERROR(0x%08x) : the shared state is already published by another process", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	/*
+	 * A page left by a previous producer is reused in place, so that mapped consumers keep following it.
+	 * A producer that crashed while writing left the sequence odd, which is first made even again:
+	 * incrementing an odd sequence would let the readers accept the values written next.
+	 */
+	sequence = __atomic_load_n(&page->sequence, __ATOMIC_RELAXED);
+	__atomic_store_n(&page->sequence, (sequence | 1) + 1, __ATOMIC_RELAXED);
+
+	runtime_info_shm_write_begin(page);
+	page->magic = RUNTIME_INFO_SHM_MAGIC;
+	page->version = RUNTIME_INFO_SHM_VERSION;
+	page->key_count = RUNTIME_INFO_KEY_COUNT;
+	page->valid = 0;
+	__atomic_store_n(&page->producer_pid, getpid(), __ATOMIC_RELEASE);
+	runtime_info_shm_write_end(page);
+
+	runtime_info_shm_published = page;
+
+	pthread_mutex_unlock(&runtime_info_shm_mutex);
+
+	/* callbacks may run as soon as a key is subscribed, so the page is published before */
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		if (runtime_info_subscribe(key, runtime_info_shm_changed_cb, NULL, &subscription) == RUNTIME_INFO_ERROR_NONE)
+		{
+			runtime_info_shm_subscriptions[key] = subscription;
+			runtime_info_shm_changed_cb(key, NULL);
+		}
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_unpublish_shared_state(void)
+{
+	runtime_info_shm_page_h page;
+	int key;
+
+	pthread_mutex_lock(&runtime_info_shm_mutex);
+
+	page = runtime_info_shm_published;
+	runtime_info_shm_published = NULL;
+
+	if (page != NULL)
+	{
+		runtime_info_shm_write_begin(page);
+		page->valid = 0;
+		__atomic_store_n(&page->producer_pid, 0, __ATOMIC_RELEASE);
+		runtime_info_shm_write_end(page);
+
+		munmap(page, sizeof(runtime_info_shm_page_s));
+		shm_unlink(RUNTIME_INFO_SHM_NAME);
+	}
+
+	pthread_mutex_unlock(&runtime_info_shm_mutex);
+
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		if (runtime_info_shm_subscriptions[key] != NULL)
+		{
+			runtime_info_unsubscribe(runtime_info_shm_subscriptions[key]);
+			runtime_info_shm_subscriptions[key] = NULL;
+		}
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_set_shared_state_enabled(bool enable)
+{
+	pthread_mutex_lock(&runtime_info_shm_mutex);
+
+	__atomic_store_n(&runtime_info_shm_check_us, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&runtime_info_shm_enabled, enable, __ATOMIC_RELEASE);
+
+	pthread_mutex_unlock(&runtime_info_shm_mutex);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+/*
+ * At most once per RUNTIME_INFO_SHM_CHECK_INTERVAL_US, checks that the producer of the mapped page is alive,
+ * or looks the page up again when there is none. A page whose producer is gone is no longer used;
+ * it stays mapped since other threads may still be reading it.
+ * Makes system calls, so the readers call it before taking runtime_info_rwlock.
+ */
+void runtime_info_shm_attach(void)
+{
+	runtime_info_shm_page_h page;
+	unsigned long long now;
+
+	if (__atomic_load_n(&runtime_info_shm_enabled, __ATOMIC_ACQUIRE) == false)
+	{
+		return;
+	}
+
+	now = runtime_info_get_monotonic_us();
+
+	if (now < __atomic_load_n(&runtime_info_shm_check_us, __ATOMIC_RELAXED) || pthread_mutex_trylock(&runtime_info_shm_mutex))
+	{
+		return;
+	}
+
+	if (now >= runtime_info_shm_check_us)
+	{
+		__atomic_store_n(&runtime_info_shm_check_us, now + RUNTIME_INFO_SHM_CHECK_INTERVAL_US, __ATOMIC_RELAXED);
+
+		page = runtime_info_shm_page;
+
+		if (page != NULL && !runtime_info_shm_producer_alive(page))
+		{
+			page = NULL;
+		}
+
+		if (page == NULL)
+		{
+			page = runtime_info_shm_map(false);
+
+			if (page != NULL && (page->magic != RUNTIME_INFO_SHM_MAGIC || page->version != RUNTIME_INFO_SHM_VERSION
+				|| page->key_count != RUNTIME_INFO_KEY_COUNT || !runtime_info_shm_producer_alive(page)))
+			{
+				munmap(page, sizeof(runtime_info_shm_page_s));
+				page = NULL;
+			}
+		}
+
+		__atomic_store_n(&runtime_info_shm_page, page, __ATOMIC_RELEASE);
+	}
+
+	pthread_mutex_unlock(&runtime_info_shm_mutex);
+}
+
+/*
+ * Reads the value published for the key in the page mapped by runtime_info_shm_attach(), with plain memory loads only.
+ * Fails when shared state is disabled, no live producer has published the key, or the producer keeps writing.
+ */
+int runtime_info_shm_get_value(runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_value_h value)
+{
+	runtime_info_shm_page_h page;
+	runtime_info_shm_value_s shm_value;
+	unsigned int sequence;
+	bool valid = false;
+	int retry;
+
+	if (__atomic_load_n(&runtime_info_shm_enabled, __ATOMIC_ACQUIRE) == false)
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	page = __atomic_load_n(&runtime_info_shm_page, __ATOMIC_ACQUIRE);
+
+	if (page == NULL)
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	for (retry = 0; retry < RUNTIME_INFO_SHM_READ_RETRIES; retry++)
+	{
+		sequence = __atomic_load_n(&page->sequence, __ATOMIC_ACQUIRE);
+
+		if (sequence & 1)
+		{
+			continue;
+		}
+
+		valid = (page->valid & RUNTIME_INFO_KEY_BIT(key)) != 0 && page->producer_pid != 0;
+		memcpy(&shm_value, &page->values[key], sizeof(runtime_info_shm_value_s));
+
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+		if (__atomic_load_n(&page->sequence, __ATOMIC_RELAXED) == sequence)
+		{
+			break;
+		}
+	}
+
+	if (retry == RUNTIME_INFO_SHM_READ_RETRIES || valid == false)
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	switch (data_type)
+	{
+	case RUNTIME_INFO_DATA_TYPE_INT:
+		value->i = shm_value.i;
+		break;
+
+	case RUNTIME_INFO_DATA_TYPE_BOOL:
+		value->b = shm_value.b;
+		break;
+
+	case RUNTIME_INFO_DATA_TYPE_DOUBLE:
+		value->d = shm_value.d;
+		break;
+
+	case RUNTIME_INFO_DATA_TYPE_STRING:
+		shm_value.string[RUNTIME_INFO_SHM_STRING_SIZE - 1] = '\0';
+		value->s = strdup(shm_value.string);
+
+		if (value->s == NULL)
+		{
+			return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
+		}
+		break;
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
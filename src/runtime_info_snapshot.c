@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+#define RUNTIME_INFO_SNAPSHOT_STRING_POOL 64
+
+/*
+ * Strings are packed into string_pool so that a snapshot normally costs a single allocation;
+ * a string that does not fit keeps its own buffer and is marked in heap_strings.
+ */
+typedef struct runtime_info_snapshot_s {
+	unsigned int sequence;
+	unsigned long long valid;
+	unsigned long long heap_strings;
+	runtime_info_value_u values[RUNTIME_INFO_KEY_COUNT];
+	int string_pool_used;
+	char string_pool[RUNTIME_INFO_SNAPSHOT_STRING_POOL];
+} runtime_info_snapshot_s;
+
+static unsigned int runtime_info_snapshot_sequence = 0;
+
+static void runtime_info_snapshot_store_string(runtime_info_snapshot_h snapshot, int key)
+{
+	char *value = snapshot->values[key].s;
+	int length = strlen(value) + 1;
+
+	if (snapshot->string_pool_used + length <= RUNTIME_INFO_SNAPSHOT_STRING_POOL)
+	{
+		snapshot->values[key].s = memcpy(snapshot->string_pool + snapshot->string_pool_used, value, length);
+		snapshot->string_pool_used += length;
+		free(value);
+	}
+	else
+	{
+		snapshot->heap_strings |= RUNTIME_INFO_KEY_BIT(key);
+	}
+}
+
+int runtime_info_snapshot_create(runtime_info_snapshot_h *snapshot)
+{
+	runtime_info_snapshot_h new_snapshot;
+	runtime_info_key_e keys[RUNTIME_INFO_KEY_COUNT];
+	int results[RUNTIME_INFO_KEY_COUNT];
+	runtime_info_data_type_e data_type;
+	int key;
+
+	if (snapshot == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	new_snapshot = calloc(1, sizeof(runtime_info_snapshot_s));
+
+	if (new_snapshot == NULL)
+	{
+		LOGE("[%s] OUT_OF_MEMORY(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_OUT_OF_MEMORY);
+		return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
+	}
+
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		keys[key] = key;
+	}
+
+	runtime_info_get_values(keys, RUNTIME_INFO_KEY_COUNT, new_snapshot->values, results);
+
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		if (results[key] != RUNTIME_INFO_ERROR_NONE)
+		{
+			continue;
+		}
+
+		new_snapshot->valid |= RUNTIME_INFO_KEY_BIT(key);
+
+		runtime_info_get_data_type(key, &data_type);
+
+		if (data_type == RUNTIME_INFO_DATA_TYPE_STRING)
+		{
+			runtime_info_snapshot_store_string(new_snapshot, key);
+		}
+	}
+
+	new_snapshot->sequence = __sync_add_and_fetch(&runtime_info_snapshot_sequence, 1);
+
+	*snapshot = new_snapshot;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_snapshot_destroy(runtime_info_snapshot_h snapshot)
+{
+	int key;
+
+	if (snapshot == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		if (snapshot->heap_strings & RUNTIME_INFO_KEY_BIT(key))
+		{
+			free(snapshot->values[key].s);
+		}
+	}
+
+	free(snapshot);
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_snapshot_get_sequence(runtime_info_snapshot_h snapshot, unsigned int *sequence)
+{
+	if (snapshot == NULL || sequence == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	*sequence = snapshot->sequence;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+static int runtime_info_snapshot_get_value(runtime_info_snapshot_h snapshot, runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_value_h *value)
+{
+	runtime_info_data_type_e key_data_type;
+
+	if (snapshot == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid snapshot", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (runtime_info_get_data_type(key, &key_data_type))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (key_data_type != data_type)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid data type", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (!(snapshot->valid & RUNTIME_INFO_KEY_BIT(key)))
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : value was not captured / key(%d)", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR, key);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	*value = &snapshot->values[key];
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_snapshot_get_value_int(runtime_info_snapshot_h snapshot, runtime_info_key_e key, int *value)
+{
+	runtime_info_value_h snapshot_value;
+	int retcode;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_snapshot_get_value(snapshot, key, RUNTIME_INFO_DATA_TYPE_INT, &snapshot_value);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*value = snapshot_value->i;
+	}
+
+	return retcode;
+}
+
+int runtime_info_snapshot_get_value_bool(runtime_info_snapshot_h snapshot, runtime_info_key_e key, bool *value)
+{
+	runtime_info_value_h snapshot_value;
+	int retcode;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_snapshot_get_value(snapshot, key, RUNTIME_INFO_DATA_TYPE_BOOL, &snapshot_value);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*value = snapshot_value->b;
+	}
+
+	return retcode;
+}
+
+int runtime_info_snapshot_get_value_double(runtime_info_snapshot_h snapshot, runtime_info_key_e key, double *value)
+{
+	runtime_info_value_h snapshot_value;
+	int retcode;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_snapshot_get_value(snapshot, key, RUNTIME_INFO_DATA_TYPE_DOUBLE, &snapshot_value);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*value = snapshot_value->d;
+	}
+
+	return retcode;
+}
+
+int runtime_info_snapshot_get_value_string(runtime_info_snapshot_h snapshot, runtime_info_key_e key, const char **value)
+{
+	runtime_info_value_h snapshot_value;
+	int retcode;
+
+	if (value == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	retcode = runtime_info_snapshot_get_value(snapshot, key, RUNTIME_INFO_DATA_TYPE_STRING, &snapshot_value);
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		*value = snapshot_value->s;
+	}
+
+	return retcode;
+}
+
+int runtime_info_snapshot_compare(runtime_info_snapshot_h snapshot1, runtime_info_snapshot_h snapshot2, unsigned long long *changed_keys)
+{
+	runtime_info_data_type_e data_type;
+	runtime_info_value_h value1;
+	runtime_info_value_h value2;
+	unsigned long long changed;
+	int key;
+
+	if (snapshot1 == NULL || snapshot2 == NULL || changed_keys == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x)", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	changed = snapshot1->valid ^ snapshot2->valid;
+
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		if (!(snapshot1->valid & snapshot2->valid & RUNTIME_INFO_KEY_BIT(key)))
+		{
+			continue;
+		}
+
+		value1 = &snapshot1->values[key];
+		value2 = &snapshot2->values[key];
+
+		runtime_info_get_data_type(key, &data_type);
+
+		if (!runtime_info_value_equal(data_type, value1, value2))
+		{
+			changed |= RUNTIME_INFO_KEY_BIT(key);
+		}
+	}
+
+	*changed_keys = changed;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
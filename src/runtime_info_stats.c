@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+/* every field of runtime_info_stats_s is a counter, so it is accessed as an array of them */
+#define RUNTIME_INFO_STATS_COUNTERS (sizeof(runtime_info_stats_s) / sizeof(unsigned long long))
+
+runtime_info_stats_s runtime_info_stats_table[RUNTIME_INFO_KEY_COUNT];
+
+unsigned long long runtime_info_stats_record_latency(unsigned long long *histogram, unsigned long long start_ns)
+{
+	unsigned long long latency = runtime_info_get_monotonic_ns() - start_ns;
+	int bucket = 0;
+
+	if (latency > 1)
+	{
+		bucket = 63 - __builtin_clzll(latency);
+	}
+
+	if (bucket >= RUNTIME_INFO_STATS_HISTOGRAM_SIZE)
+	{
+		bucket = RUNTIME_INFO_STATS_HISTOGRAM_SIZE - 1;
+	}
+
+	__atomic_fetch_add(&histogram[bucket], 1, __ATOMIC_RELAXED);
+
+	return latency;
+}
+
+int runtime_info_get_stats(runtime_info_key_e key, runtime_info_stats_s *stats)
+{
+	unsigned long long *counters;
+	unsigned long long *copy;
+	int index;
+
+	if ((unsigned int)key >= RUNTIME_INFO_KEY_COUNT)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (stats == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid output param", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	counters = (unsigned long long *)&runtime_info_stats_table[key];
+	copy = (unsigned long long *)stats;
+
+	for (index = 0; index < RUNTIME_INFO_STATS_COUNTERS; index++)
+	{
+		copy[index] = __atomic_load_n(&counters[index], __ATOMIC_RELAXED);
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_reset_stats(void)
+{
+	unsigned long long *counters;
+	int key;
+	int index;
+
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		counters = (unsigned long long *)&runtime_info_stats_table[key];
+
+		for (index = 0; index < RUNTIME_INFO_STATS_COUNTERS; index++)
+		{
+			__atomic_store_n(&counters[index], 0, __ATOMIC_RELAXED);
+		}
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
@@ -59,18 +59,23 @@ int runtime_info_flightmode_get_value(runtime_info_value_h value)
 
 int runtime_info_flightmode_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_FLIGHT_MODE, RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_FLIGHT_MODE, RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED);
 }
 
 void runtime_info_flightmode_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_FLIGHT_MODE, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_FLIGHT_MODE, RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED);
 }
 
 int runtime_info_audiojack_get_value (runtime_info_value_h value)
 {
 	int vconf_value;
 
+	if (runtime_info_uevent_get_value(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED, value) == RUNTIME_INFO_ERROR_NONE)
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
 	if (runtime_info_vconf_get_value_int(VCONF_AUDIO_JACK, &vconf_value))
 	{
 		return RUNTIME_INFO_ERROR_IO_ERROR;
@@ -93,12 +98,20 @@ int runtime_info_audiojack_get_value (runtime_info_value_h value)
 
 int runtime_info_audiojack_set_event_cb ()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_AUDIO_JACK, RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED, 0);
+	if (runtime_info_vconf_set_event_cb(VCONF_AUDIO_JACK, RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED))
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	runtime_info_uevent_watch(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED);
+
+	return RUNTIME_INFO_ERROR_NONE;
 }
 
 void runtime_info_audiojack_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_AUDIO_JACK, 0);
+	runtime_info_uevent_unwatch(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED);
+	runtime_info_vconf_unset_event_cb(VCONF_AUDIO_JACK, RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED);
 }
 
 int runtime_info_silent_mode_get_value(runtime_info_value_h value)
@@ -117,12 +130,12 @@ int runtime_info_silent_mode_get_value(runtime_info_value_h value)
 
 int runtime_info_silent_mode_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_SILENT_MODE, RUNTIME_INFO_KEY_SILENT_MODE_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_SILENT_MODE, RUNTIME_INFO_KEY_SILENT_MODE_ENABLED);
 }
 
 void runtime_info_silent_mode_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_SILENT_MODE, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_SILENT_MODE, RUNTIME_INFO_KEY_SILENT_MODE_ENABLED);
 }
 
 int runtime_info_vibration_enabled_get_value(runtime_info_value_h value)
@@ -141,12 +154,12 @@ int runtime_info_vibration_enabled_get_value(runtime_info_value_h value)
 
 int runtime_info_vibration_enabled_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_VIBRATION_ENABLED, RUNTIME_INFO_KEY_VIBRATION_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_VIBRATION_ENABLED, RUNTIME_INFO_KEY_VIBRATION_ENABLED);
 }
 
 void runtime_info_vibration_enabled_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_VIBRATION_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_VIBRATION_ENABLED, RUNTIME_INFO_KEY_VIBRATION_ENABLED);
 }
 
 int runtime_info_rotation_lock_enabled_get_value(runtime_info_value_h value)
@@ -165,18 +178,23 @@ int runtime_info_rotation_lock_enabled_get_value(runtime_info_value_h value)
 
 int runtime_info_rotation_lock_enabled_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_ROTATION_LOCK_ENABLED, RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_ROTATION_LOCK_ENABLED, RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED);
 }
 
 void runtime_info_rotation_lock_enabled_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_ROTATION_LOCK_ENABLED, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_ROTATION_LOCK_ENABLED, RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED);
 }
 
 int runtime_info_battery_charging_get_value (runtime_info_value_h value)
 {
 	int vconf_value;
 
+	if (runtime_info_power_supply_get_battery_charging(&value->b) == RUNTIME_INFO_ERROR_NONE)
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
 	if (runtime_info_vconf_get_value_int(VCONF_BATTERY_CHARGING, &vconf_value))
 	{
 		return RUNTIME_INFO_ERROR_IO_ERROR;
@@ -189,12 +207,20 @@ int runtime_info_battery_charging_get_value (runtime_info_value_h value)
 
 int runtime_info_battery_charging_set_event_cb ()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_BATTERY_CHARGING, RUNTIME_INFO_KEY_BATTERY_IS_CHARGING, 0);
+	if (runtime_info_vconf_set_event_cb(VCONF_BATTERY_CHARGING, RUNTIME_INFO_KEY_BATTERY_IS_CHARGING))
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	runtime_info_uevent_watch(RUNTIME_INFO_KEY_BATTERY_IS_CHARGING);
+
+	return RUNTIME_INFO_ERROR_NONE;
 }
 
 void runtime_info_battery_charging_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_BATTERY_CHARGING, 0);
+	runtime_info_uevent_unwatch(RUNTIME_INFO_KEY_BATTERY_IS_CHARGING);
+	runtime_info_vconf_unset_event_cb(VCONF_BATTERY_CHARGING, RUNTIME_INFO_KEY_BATTERY_IS_CHARGING);
 }
 
 
@@ -202,6 +228,11 @@ int runtime_info_tvout_connected_get_value (runtime_info_value_h value)
 {
 	int vconf_value;
 
+	if (runtime_info_uevent_get_value(RUNTIME_INFO_KEY_TV_OUT_CONNECTED, value) == RUNTIME_INFO_ERROR_NONE)
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
 	if (runtime_info_vconf_get_value_int(VCONF_TVOUT_CONNECTED, &vconf_value))
 	{
 		return RUNTIME_INFO_ERROR_IO_ERROR;
@@ -223,12 +254,20 @@ int runtime_info_tvout_connected_get_value (runtime_info_value_h value)
 
 int runtime_info_tvout_connected_set_event_cb ()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_TVOUT_CONNECTED, RUNTIME_INFO_KEY_TV_OUT_CONNECTED, 1);
+	if (runtime_info_vconf_set_event_cb(VCONF_TVOUT_CONNECTED, RUNTIME_INFO_KEY_TV_OUT_CONNECTED))
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	runtime_info_uevent_watch(RUNTIME_INFO_KEY_TV_OUT_CONNECTED);
+
+	return RUNTIME_INFO_ERROR_NONE;
 }
 
 void runtime_info_tvout_connected_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_TVOUT_CONNECTED, 1);
+	runtime_info_uevent_unwatch(RUNTIME_INFO_KEY_TV_OUT_CONNECTED);
+	runtime_info_vconf_unset_event_cb(VCONF_TVOUT_CONNECTED, RUNTIME_INFO_KEY_TV_OUT_CONNECTED);
 }
 
 
@@ -236,6 +275,11 @@ int runtime_info_audio_jack_status_get_value (runtime_info_value_h value)
 {
 	int vconf_value;
 
+	if (runtime_info_uevent_get_value(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS, value) == RUNTIME_INFO_ERROR_NONE)
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
 	if (runtime_info_vconf_get_value_int(VCONF_AUDIO_JACK_STATUS, &vconf_value))
 	{
 		return RUNTIME_INFO_ERROR_IO_ERROR;
@@ -261,12 +305,20 @@ int runtime_info_audio_jack_status_get_value (runtime_info_value_h value)
 
 int runtime_info_audio_jack_status_set_event_cb ()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_AUDIO_JACK_STATUS, RUNTIME_INFO_KEY_AUDIO_JACK_STATUS, 2);
+	if (runtime_info_vconf_set_event_cb(VCONF_AUDIO_JACK_STATUS, RUNTIME_INFO_KEY_AUDIO_JACK_STATUS))
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	runtime_info_uevent_watch(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS);
+
+	return RUNTIME_INFO_ERROR_NONE;
 }
 
 void runtime_info_audio_jack_status_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_AUDIO_JACK_STATUS, 2);
+	runtime_info_uevent_unwatch(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS);
+	runtime_info_vconf_unset_event_cb(VCONF_AUDIO_JACK_STATUS, RUNTIME_INFO_KEY_AUDIO_JACK_STATUS);
 }
 
 
@@ -302,12 +354,12 @@ int runtime_info_sliding_keyboard_opened_get_value (runtime_info_value_h value)
 
 int runtime_info_sliding_keyboard_opened_set_event_cb ()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_SLIDING_KEYBOARD_STATUS, RUNTIME_INFO_KEY_SLIDING_KEYBOARD_OPENED, 0);
+	return runtime_info_vconf_set_event_cb(VCONF_SLIDING_KEYBOARD_STATUS, RUNTIME_INFO_KEY_SLIDING_KEYBOARD_OPENED);
 }
 
 void runtime_info_sliding_keyboard_opened_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_SLIDING_KEYBOARD_STATUS, 0);
+	runtime_info_vconf_unset_event_cb(VCONF_SLIDING_KEYBOARD_STATUS, RUNTIME_INFO_KEY_SLIDING_KEYBOARD_OPENED);
 }
 
 
@@ -315,6 +367,11 @@ int runtime_info_usb_connected_get_value(runtime_info_value_h value)
 {
 	int vconf_value;
 
+	if (runtime_info_uevent_get_value(RUNTIME_INFO_KEY_USB_CONNECTED, value) == RUNTIME_INFO_ERROR_NONE)
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
 	if (runtime_info_vconf_get_value_int(VCONF_USB_CONNECTED, &vconf_value))
 	{
 		return RUNTIME_INFO_ERROR_IO_ERROR;
@@ -343,18 +400,31 @@ int runtime_info_usb_connected_get_value(runtime_info_value_h value)
 
 int runtime_info_usb_connected_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_USB_CONNECTED, RUNTIME_INFO_KEY_USB_CONNECTED, 0);
+	if (runtime_info_vconf_set_event_cb(VCONF_USB_CONNECTED, RUNTIME_INFO_KEY_USB_CONNECTED))
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	runtime_info_uevent_watch(RUNTIME_INFO_KEY_USB_CONNECTED);
+
+	return RUNTIME_INFO_ERROR_NONE;
 }
 
 void runtime_info_usb_connected_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_USB_CONNECTED, 0);
+	runtime_info_uevent_unwatch(RUNTIME_INFO_KEY_USB_CONNECTED);
+	runtime_info_vconf_unset_event_cb(VCONF_USB_CONNECTED, RUNTIME_INFO_KEY_USB_CONNECTED);
 }
 
 int runtime_info_charger_connected_get_value(runtime_info_value_h value)
 {
 	int vconf_value;
 
+	if (runtime_info_power_supply_get_charger_connected(&value->b) == RUNTIME_INFO_ERROR_NONE)
+	{
+		return RUNTIME_INFO_ERROR_NONE;
+	}
+
 	if (runtime_info_vconf_get_value_int(VCONF_CHARGER_CONNECTED, &vconf_value))
 	{
 		return RUNTIME_INFO_ERROR_IO_ERROR;
@@ -379,12 +449,20 @@ int runtime_info_charger_connected_get_value(runtime_info_value_h value)
 
 int runtime_info_charger_connected_set_event_cb()
 {
-	return runtime_info_vconf_set_event_cb(VCONF_CHARGER_CONNECTED, RUNTIME_INFO_KEY_CHARGER_CONNECTED, 0);
+	if (runtime_info_vconf_set_event_cb(VCONF_CHARGER_CONNECTED, RUNTIME_INFO_KEY_CHARGER_CONNECTED))
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	runtime_info_uevent_watch(RUNTIME_INFO_KEY_CHARGER_CONNECTED);
+
+	return RUNTIME_INFO_ERROR_NONE;
 }
 
 void runtime_info_charger_connected_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONF_CHARGER_CONNECTED, 0);
+	runtime_info_uevent_unwatch(RUNTIME_INFO_KEY_CHARGER_CONNECTED);
+	runtime_info_vconf_unset_event_cb(VCONF_CHARGER_CONNECTED, RUNTIME_INFO_KEY_CHARGER_CONNECTED);
 }
 
 
@@ -416,12 +494,12 @@ int runtime_info_vibration_level_haptic_feedback_get_value (runtime_info_value_h
 
 int runtime_info_vibration_level_haptic_feedback_set_event_cb ()
 {
-	return runtime_info_vconf_set_event_cb(VCONFKEY_SETAPPL_TOUCH_FEEDBACK_VIBRATION_LEVEL_INT, RUNTIME_INFO_KEY_VIBRATION_LEVEL_HAPTIC_FEEDBACK, 0);
+	return runtime_info_vconf_set_event_cb(VCONFKEY_SETAPPL_TOUCH_FEEDBACK_VIBRATION_LEVEL_INT, RUNTIME_INFO_KEY_VIBRATION_LEVEL_HAPTIC_FEEDBACK);
 }
 
 void runtime_info_vibration_level_haptic_feedback_unset_event_cb()
 {
-	runtime_info_vconf_unset_event_cb(VCONFKEY_SETAPPL_TOUCH_FEEDBACK_VIBRATION_LEVEL_INT, 0);
+	runtime_info_vconf_unset_event_cb(VCONFKEY_SETAPPL_TOUCH_FEEDBACK_VIBRATION_LEVEL_INT, RUNTIME_INFO_KEY_VIBRATION_LEVEL_HAPTIC_FEEDBACK);
 }
 
 
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+/*
+ * A single library-owned thread fires the trailing edge of coalesced change events.
+ * Each key has at most one pending deadline; 0 means none.
+ */
+static pthread_mutex_t runtime_info_timer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t runtime_info_timer_cond;
+static bool runtime_info_timer_started = false;
+static unsigned long long runtime_info_timer_deadlines[RUNTIME_INFO_KEY_COUNT];
+
+unsigned long long runtime_info_get_monotonic_us(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (unsigned long long)now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+}
+
+unsigned long long runtime_info_get_monotonic_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static void *runtime_info_timer_thread(void *data)
+{
+	unsigned long long now;
+	unsigned long long next;
+	struct timespec timeout;
+	int key;
+
+	pthread_mutex_lock(&runtime_info_timer_mutex);
+
+	while (1)
+	{
+		now = runtime_info_get_monotonic_us();
+		next = 0;
+
+		for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+		{
+			if (runtime_info_timer_deadlines[key] == 0)
+			{
+				continue;
+			}
+
+			if (runtime_info_timer_deadlines[key] <= now)
+			{
+				runtime_info_timer_deadlines[key] = 0;
+
+				pthread_mutex_unlock(&runtime_info_timer_mutex);
+				runtime_info_redispatch(key);
+				pthread_mutex_lock(&runtime_info_timer_mutex);
+
+				now = runtime_info_get_monotonic_us();
+			}
+			else if (next == 0 || runtime_info_timer_deadlines[key] < next)
+			{
+				next = runtime_info_timer_deadlines[key];
+			}
+		}
+
+		if (next == 0)
+		{
+			pthread_cond_wait(&runtime_info_timer_cond, &runtime_info_timer_mutex);
+		}
+		else
+		{
+			timeout.tv_sec = next / 1000000ULL;
+			timeout.tv_nsec = (next % 1000000ULL) * 1000;
+			pthread_cond_timedwait(&runtime_info_timer_cond, &runtime_info_timer_mutex, &timeout);
+		}
+	}
+
+	return NULL;
+}
+
+static int runtime_info_timer_start(void)
+{
+	pthread_condattr_t condattr;
+	pthread_t thread;
+
+	pthread_condattr_init(&condattr);
+	pthread_condattr_setclock(&condattr, CLOCK_MONOTONIC);
+	pthread_cond_init(&runtime_info_timer_cond, &condattr);
+	pthread_condattr_destroy(&condattr);
+
+	if (pthread_create(&thread, NULL, runtime_info_timer_thread, NULL))
+	{
+		pthread_cond_destroy(&runtime_info_timer_cond);
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	pthread_detach(thread);
+
+	runtime_info_timer_started = true;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+int runtime_info_timer_schedule(runtime_info_key_e key, unsigned long long deadline_us)
+{
+	int retcode = RUNTIME_INFO_ERROR_NONE;
+
+	pthread_mutex_lock(&runtime_info_timer_mutex);
+
+	if (runtime_info_timer_started == false)
+	{
+		retcode = runtime_info_timer_start();
+	}
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE && runtime_info_timer_deadlines[key] == 0)
+	{
+		runtime_info_timer_deadlines[key] = deadline_us;
+		pthread_cond_signal(&runtime_info_timer_cond);
+	}
+
+	pthread_mutex_unlock(&runtime_info_timer_mutex);
+
+	return retcode;
+}
+
+void runtime_info_timer_cancel(runtime_info_key_e key)
+{
+	pthread_mutex_lock(&runtime_info_timer_mutex);
+
+	runtime_info_timer_deadlines[key] = 0;
+
+	pthread_mutex_unlock(&runtime_info_timer_mutex);
+}
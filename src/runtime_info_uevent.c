@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+#define RUNTIME_INFO_UEVENT_BUFFER_SIZE 4096
+
+/*
+ * Listens to the kobject uevents of the kernel, so that hotplug changes are notified without waiting for
+ * the system daemon to copy them into vconf. The listener is enabled by setting the RUNTIME_INFO_UEVENT
+ * environment variable, and started when the first key it serves is watched.
+ *
+ * switch and android_usb uevents carry the new state, which is kept per watched key and returned by
+ * runtime_info_uevent_get_value() in preference to vconf; the state of a key is dropped when it is unwatched
+ * or when the listener stops, so that vconf is used again. power_supply uevents only trigger a notification;
+ * the value is then read by the power supply source if it is enabled.
+ *
+ * RUNTIME_INFO_KEY_USB_CONNECTED keeps the meaning it has in vconf, where it is true only once the USB
+ * connection is configured (VCONFKEY_SYSMAN_USB_AVAILABLE), not when the cable alone is plugged.
+ */
+static pthread_mutex_t runtime_info_uevent_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool runtime_info_uevent_started = false;
+static unsigned long long runtime_info_uevent_watched = 0;
+static unsigned long long runtime_info_uevent_valid = 0;
+static int runtime_info_uevent_values[RUNTIME_INFO_KEY_COUNT];
+
+/* a field value of a uevent message, which is not NUL-terminated when it ends the message */
+typedef struct {
+	const char *value;
+	int length;
+} runtime_info_uevent_field_s;
+
+static bool runtime_info_uevent_field_equal(const runtime_info_uevent_field_s *field, const char *value)
+{
+	return field->value != NULL && field->length == strlen(value) && !memcmp(field->value, value, field->length);
+}
+
+static int runtime_info_uevent_field_int(const runtime_info_uevent_field_s *field)
+{
+	int value = 0;
+	int index;
+
+	for (index = 0; index < field->length && field->value[index] >= '0' && field->value[index] <= '9'; index++)
+	{
+		value = value * 10 + (field->value[index] - '0');
+	}
+
+	return value;
+}
+
+static bool runtime_info_uevent_field_match(const char *field, int length, const char *name, runtime_info_uevent_field_s *value)
+{
+	int name_length = strlen(name);
+
+	if (length < name_length || memcmp(field, name, name_length))
+	{
+		return false;
+	}
+
+	value->value = field + name_length;
+	value->length = length - name_length;
+
+	return true;
+}
+
+/* called with runtime_info_uevent_mutex held; the state of a key nobody watches is not kept */
+static void runtime_info_uevent_store(runtime_info_key_e key, int value, unsigned long long *changed)
+{
+	if (!(runtime_info_uevent_watched & RUNTIME_INFO_KEY_BIT(key)))
+	{
+		return;
+	}
+
+	__atomic_store_n(&runtime_info_uevent_values[key], value, __ATOMIC_RELAXED);
+	__atomic_fetch_or(&runtime_info_uevent_valid, RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE);
+
+	*changed |= RUNTIME_INFO_KEY_BIT(key);
+}
+
+/* called with runtime_info_uevent_mutex held; the key is read from vconf again */
+static void runtime_info_uevent_forget(runtime_info_key_e key, unsigned long long *changed)
+{
+	__atomic_fetch_and(&runtime_info_uevent_valid, ~RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE);
+
+	*changed |= RUNTIME_INFO_KEY_BIT(key);
+}
+
+static void runtime_info_uevent_switch(const runtime_info_uevent_field_s *name, int state, unsigned long long *changed)
+{
+	if (runtime_info_uevent_field_equal(name, "h2w"))
+	{
+		/* bit 0 is a headset with a microphone, bit 1 a headphone without one */
+		runtime_info_uevent_store(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED, state != 0, changed);
+		runtime_info_uevent_store(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS,
+			(state & 1) ? RUNTIME_INFO_AUDIO_JACK_STATUS_CONNECTED_4WIRE :
+			(state & 2) ? RUNTIME_INFO_AUDIO_JACK_STATUS_CONNECTED_3WIRE : RUNTIME_INFO_AUDIO_JACK_STATUS_UNCONNECTED, changed);
+	}
+	else if (runtime_info_uevent_field_equal(name, "hdmi") || runtime_info_uevent_field_equal(name, "tvout"))
+	{
+		runtime_info_uevent_store(RUNTIME_INFO_KEY_TV_OUT_CONNECTED, state != 0, changed);
+	}
+	else if (runtime_info_uevent_field_equal(name, "usb_cable"))
+	{
+		/* an unplugged cable is disconnected, but a plugged one says nothing of the configuration */
+		if (state == 0)
+		{
+			runtime_info_uevent_store(RUNTIME_INFO_KEY_USB_CONNECTED, false, changed);
+		}
+		else
+		{
+			runtime_info_uevent_forget(RUNTIME_INFO_KEY_USB_CONNECTED, changed);
+		}
+	}
+}
+
+static void runtime_info_uevent_notify(unsigned long long changed)
+{
+	int key;
+
+	changed &= __atomic_load_n(&runtime_info_uevent_watched, __ATOMIC_ACQUIRE);
+
+	for (key = 0; changed != 0 && key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		if (changed & RUNTIME_INFO_KEY_BIT(key))
+		{
+			changed &= ~RUNTIME_INFO_KEY_BIT(key);
+			runtime_info_updated(key);
+		}
+	}
+}
+
+/*
+ * Parses one uevent message, "ACTION@DEVPATH" followed by KEY=VALUE fields separated by NUL,
+ * and notifies the watched keys it affects. No field is read past length.
+ */
+void runtime_info_uevent_process(const char *message, int length)
+{
+	runtime_info_uevent_field_s subsystem = { NULL, 0 };
+	runtime_info_uevent_field_s switch_name = { NULL, 0 };
+	runtime_info_uevent_field_s switch_state = { NULL, 0 };
+	runtime_info_uevent_field_s usb_state = { NULL, 0 };
+	const char *end = message + length;
+	const char *field;
+	unsigned long long changed = 0;
+	int field_length;
+
+	for (field = message; field < end; field += field_length + 1)
+	{
+		field_length = strnlen(field, end - field);
+
+		runtime_info_uevent_field_match(field, field_length, "SUBSYSTEM=", &subsystem);
+		runtime_info_uevent_field_match(field, field_length, "SWITCH_NAME=", &switch_name);
+		runtime_info_uevent_field_match(field, field_length, "SWITCH_STATE=", &switch_state);
+		runtime_info_uevent_field_match(field, field_length, "USB_STATE=", &usb_state);
+	}
+
+	pthread_mutex_lock(&runtime_info_uevent_mutex);
+
+	if (runtime_info_uevent_field_equal(&subsystem, "power_supply"))
+	{
+		changed = RUNTIME_INFO_KEY_BIT(RUNTIME_INFO_KEY_CHARGER_CONNECTED) | RUNTIME_INFO_KEY_BIT(RUNTIME_INFO_KEY_BATTERY_IS_CHARGING);
+	}
+	else if (runtime_info_uevent_field_equal(&subsystem, "switch") && switch_name.value != NULL && switch_state.value != NULL)
+	{
+		runtime_info_uevent_switch(&switch_name, runtime_info_uevent_field_int(&switch_state), &changed);
+	}
+	else if (runtime_info_uevent_field_equal(&subsystem, "android_usb") && usb_state.value != NULL)
+	{
+		runtime_info_uevent_store(RUNTIME_INFO_KEY_USB_CONNECTED, runtime_info_uevent_field_equal(&usb_state, "CONFIGURED"), &changed);
+	}
+
+	pthread_mutex_unlock(&runtime_info_uevent_mutex);
+
+	runtime_info_uevent_notify(changed);
+}
+
+/*
+ * Drops every state received from the kernel and notifies the watched keys, which are then read from vconf.
+ * Used when uevents were lost and when the listener stops.
+ */
+static void runtime_info_uevent_resync(void)
+{
+	unsigned long long changed;
+
+	pthread_mutex_lock(&runtime_info_uevent_mutex);
+	changed = __atomic_exchange_n(&runtime_info_uevent_valid, 0, __ATOMIC_ACQ_REL);
+	pthread_mutex_unlock(&runtime_info_uevent_mutex);
+
+	runtime_info_uevent_notify(changed);
+}
+
+static void *runtime_info_uevent_thread(void *data)
+{
+	int fd = (int)(long)data;
+	char buffer[RUNTIME_INFO_UEVENT_BUFFER_SIZE];
+	struct sockaddr_nl address;
+	socklen_t address_length;
+	ssize_t length;
+
+	while (1)
+	{
+		address_length = sizeof(address);
+		length = recvfrom(fd, buffer, sizeof(buffer) - 1, 0, (struct sockaddr *)&address, &address_length);
+
+		if (length < 0 && errno == EINTR)
+		{
+			continue;
+		}
+
+		/* uevents were lost, so the states kept so far may be outdated */
+		if (length < 0 && errno == ENOBUFS)
+		{
+			LOGE("[%s] IO_ERROR(0x%08x) : uevents were lost, reading vconf again", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+			runtime_info_uevent_resync();
+			continue;
+		}
+
+		if (length <= 0)
+		{
+			LOGE("[%s] IO_ERROR(0x%08x) : failed to receive a uevent, stopping the listener", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+			break;
+		}
+
+		/* only the kernel is trusted, not another process sending to the multicast group */
+		if (address_length != sizeof(address) || address.nl_pid != 0)
+		{
+			continue;
+		}
+
+		buffer[length] = '\0';
+		runtime_info_uevent_process(buffer, length);
+	}
+
+	close(fd);
+
+	pthread_mutex_lock(&runtime_info_uevent_mutex);
+	runtime_info_uevent_started = false;
+	pthread_mutex_unlock(&runtime_info_uevent_mutex);
+
+	runtime_info_uevent_resync();
+
+	return NULL;
+}
+
+static void runtime_info_uevent_start(void)
+{
+	struct sockaddr_nl address = { .nl_family = AF_NETLINK, .nl_groups = 1 };
+	pthread_t thread;
+	int fd;
+
+	/* a failure is not retried, vconf keeps notifying the changes */
+	runtime_info_uevent_started = true;
+
+	fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+
+	if (fd < 0)
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to open the uevent socket", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		return;
+	}
+
+	if (bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0
+		|| pthread_create(&thread, NULL, runtime_info_uevent_thread, (void *)(long)fd))
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to start the uevent listener", __FUNCTION__, RUNTIME_INFO_ERROR_IO_ERROR);
+		close(fd);
+		return;
+	}
+
+	pthread_detach(thread);
+}
+
+void runtime_info_uevent_watch(runtime_info_key_e key)
+{
+	pthread_mutex_lock(&runtime_info_uevent_mutex);
+
+	if (runtime_info_uevent_started == false && getenv("RUNTIME_INFO_UEVENT") != NULL)
+	{
+		runtime_info_uevent_start();
+	}
+
+	__atomic_fetch_or(&runtime_info_uevent_watched, RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE);
+
+	pthread_mutex_unlock(&runtime_info_uevent_mutex);
+}
+
+void runtime_info_uevent_unwatch(runtime_info_key_e key)
+{
+	pthread_mutex_lock(&runtime_info_uevent_mutex);
+
+	__atomic_fetch_and(&runtime_info_uevent_watched, ~RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE);
+	__atomic_fetch_and(&runtime_info_uevent_valid, ~RUNTIME_INFO_KEY_BIT(key), __ATOMIC_RELEASE);
+
+	pthread_mutex_unlock(&runtime_info_uevent_mutex);
+}
+
+int runtime_info_uevent_get_value(runtime_info_key_e key, runtime_info_value_h value)
+{
+	runtime_info_data_type_e data_type;
+	int state;
+
+	if (!(__atomic_load_n(&runtime_info_uevent_valid, __ATOMIC_ACQUIRE) & RUNTIME_INFO_KEY_BIT(key)))
+	{
+		return RUNTIME_INFO_ERROR_IO_ERROR;
+	}
+
+	state = __atomic_load_n(&runtime_info_uevent_values[key], __ATOMIC_RELAXED);
+
+	runtime_info_get_data_type(key, &data_type);
+
+	if (data_type == RUNTIME_INFO_DATA_TYPE_BOOL)
+	{
+		value->b = state;
+	}
+	else
+	{
+		value->i = state;
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
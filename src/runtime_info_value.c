@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+int runtime_info_copy_value(runtime_info_data_type_e data_type, runtime_info_value_h dest, runtime_info_value_h src)
+{
+	if (data_type == RUNTIME_INFO_DATA_TYPE_STRING)
+	{
+		dest->s = strdup(src->s);
+
+		if (dest->s == NULL)
+		{
+			return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	else
+	{
+		memcpy(dest, src, sizeof(runtime_info_value_u));
+	}
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
+
+void runtime_info_free_value(runtime_info_data_type_e data_type, runtime_info_value_h value)
+{
+	if (data_type == RUNTIME_INFO_DATA_TYPE_STRING)
+	{
+		free(value->s);
+		value->s = NULL;
+	}
+}
+
+bool runtime_info_value_equal(runtime_info_data_type_e data_type, runtime_info_value_h value1, runtime_info_value_h value2)
+{
+	switch (data_type)
+	{
+	case RUNTIME_INFO_DATA_TYPE_STRING:
+		if (value1->s == NULL || value2->s == NULL)
+		{
+			return value1->s == value2->s;
+		}
+
+		return !strcmp(value1->s, value2->s);
+
+	case RUNTIME_INFO_DATA_TYPE_INT:
+		return value1->i == value2->i;
+
+	case RUNTIME_INFO_DATA_TYPE_DOUBLE:
+		return value1->d == value2->d;
+
+	case RUNTIME_INFO_DATA_TYPE_BOOL:
+		return value1->b == value2->b;
+
+	default:
+		return false;
+	}
+}
+
+void runtime_info_stored_value_clear(runtime_info_data_type_e data_type, runtime_info_stored_value_h stored_value)
+{
+	if (stored_value->valid == true && data_type == RUNTIME_INFO_DATA_TYPE_STRING
+		&& stored_value->value.s != stored_value->string)
+	{
+		free(stored_value->value.s);
+	}
+
+	stored_value->valid = false;
+}
+
+int runtime_info_stored_value_set(runtime_info_data_type_e data_type, runtime_info_stored_value_h stored_value, runtime_info_value_h value)
+{
+	size_t length;
+
+	runtime_info_stored_value_clear(data_type, stored_value);
+
+	if (data_type == RUNTIME_INFO_DATA_TYPE_STRING)
+	{
+		length = strlen(value->s) + 1;
+
+		if (length <= sizeof(stored_value->string))
+		{
+			stored_value->value.s = memcpy(stored_value->string, value->s, length);
+		}
+		else if (runtime_info_copy_value(data_type, &stored_value->value, value) != RUNTIME_INFO_ERROR_NONE)
+		{
+			return RUNTIME_INFO_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	else
+	{
+		memcpy(&stored_value->value, value, sizeof(runtime_info_value_u));
+	}
+
+	stored_value->valid = true;
+
+	return RUNTIME_INFO_ERROR_NONE;
+}
@@ -30,132 +30,336 @@
 
 #define LOG_TAG "TIZEN_N_RUNTIME_INFO"
 
-int runtime_info_vconf_get_value_int(const char *vconf_key, int *value)
-{
-	return vconf_get_int(vconf_key, value);
-}
+/*
+ * While a batch is open, every vconf key is read at most once and the result is
+ * shared by all runtime information keys decoded from it.
+ */
+typedef struct {
+	const char *vconf_key;
+	runtime_info_data_type_e data_type;
+	int retcode;
+	runtime_info_value_u value;
+} runtime_info_vconf_batch_entry_s;
 
-int runtime_info_vconf_get_value_bool(const char *vconf_key, bool *value)
+typedef runtime_info_vconf_batch_entry_s *runtime_info_vconf_batch_entry_h;
+
+static __thread int runtime_info_vconf_batch_depth;
+static __thread int runtime_info_vconf_batch_count;
+static __thread runtime_info_vconf_batch_entry_s runtime_info_vconf_batch_entries[RUNTIME_INFO_KEY_COUNT];
+
+void runtime_info_vconf_batch_begin(void)
 {
-	return vconf_get_bool(vconf_key, (int*)value);
+	runtime_info_backend_h backend = runtime_info_get_backend();
+
+	if (runtime_info_vconf_batch_depth++ == 0 && backend->batch_begin != NULL)
+	{
+		backend->batch_begin();
+	}
 }
 
-int runtime_info_vconf_get_value_double(const char *vconf_key, double *value)
+void runtime_info_vconf_batch_end(void)
 {
-	return vconf_get_dbl(vconf_key, value);
+	int index;
+
+	if (runtime_info_vconf_batch_depth <= 0 || --runtime_info_vconf_batch_depth > 0)
+	{
+		return;
+	}
+
+	for (index = 0; index < runtime_info_vconf_batch_count; index++)
+	{
+		if (runtime_info_vconf_batch_entries[index].data_type == RUNTIME_INFO_DATA_TYPE_STRING)
+		{
+			free(runtime_info_vconf_batch_entries[index].value.s);
+		}
+	}
+
+	runtime_info_vconf_batch_count = 0;
+
+	if (runtime_info_get_backend()->batch_end != NULL)
+	{
+		runtime_info_get_backend()->batch_end();
+	}
 }
 
-int runtime_info_vconf_get_value_string(const char *vconf_key, char **value)
+static runtime_info_vconf_batch_entry_h runtime_info_vconf_batch_lookup(const char *vconf_key, runtime_info_data_type_e data_type)
 {
-	char *str_value = NULL;
+	int index;
 
-	str_value = vconf_get_str(vconf_key);
-		
-	if (str_value != NULL)
+	if (runtime_info_vconf_batch_depth <= 0)
 	{
-		*value = str_value;
-		return 0;
+		return NULL;
 	}
-	else
+
+	for (index = 0; index < runtime_info_vconf_batch_count; index++)
 	{
-		return -1;
+		if (runtime_info_vconf_batch_entries[index].data_type == data_type
+			&& !strcmp(runtime_info_vconf_batch_entries[index].vconf_key, vconf_key))
+		{
+			return &runtime_info_vconf_batch_entries[index];
+		}
 	}
-}
 
-typedef void (*runtime_info_vconf_event_cb)(keynode_t *node, void *event_data);
+	return NULL;
+}
 
-static void runtime_info_vconf_event_cb0(keynode_t *node, void *event_data)
+static runtime_info_vconf_batch_entry_h runtime_info_vconf_batch_record(const char *vconf_key, runtime_info_data_type_e data_type, int retcode)
 {
-	if (node != NULL)
+	runtime_info_vconf_batch_entry_h entry;
+
+	if (runtime_info_vconf_batch_depth <= 0 || runtime_info_vconf_batch_count >= RUNTIME_INFO_KEY_COUNT)
 	{
-		runtime_info_updated((runtime_info_key_e)event_data);
-	}		
+		return NULL;
+	}
+
+	entry = &runtime_info_vconf_batch_entries[runtime_info_vconf_batch_count++];
+	entry->vconf_key = vconf_key;
+	entry->data_type = data_type;
+	entry->retcode = retcode;
+	memset(&entry->value, 0, sizeof(runtime_info_value_u));
+
+	return entry;
 }
 
-static void runtime_info_vconf_event_cb1(keynode_t *node, void *event_data)
+int runtime_info_vconf_get_value_int(const char *vconf_key, int *value)
 {
-	if (node != NULL)
+	runtime_info_vconf_batch_entry_h entry;
+	unsigned long long start;
+	int retcode;
+
+	entry = runtime_info_vconf_batch_lookup(vconf_key, RUNTIME_INFO_DATA_TYPE_INT);
+
+	if (entry != NULL)
 	{
-		runtime_info_updated((runtime_info_key_e)event_data);
-	}		
+		*value = entry->value.i;
+		return entry->retcode;
+	}
+
+	start = RUNTIME_INFO_TRACE_CLOCK();
+	retcode = runtime_info_get_backend()->get_int(vconf_key, value);
+	RUNTIME_INFO_TRACE3(vconf_read, vconf_key, retcode, RUNTIME_INFO_TRACE_CLOCK() - start);
+
+	entry = runtime_info_vconf_batch_record(vconf_key, RUNTIME_INFO_DATA_TYPE_INT, retcode);
+
+	if (entry != NULL && retcode == 0)
+	{
+		entry->value.i = *value;
+	}
+
+	return retcode;
 }
 
-static void runtime_info_vconf_event_cb2(keynode_t *node, void *event_data)
+int runtime_info_vconf_get_value_bool(const char *vconf_key, bool *value)
 {
-	if (node != NULL)
+	runtime_info_vconf_batch_entry_h entry;
+	unsigned long long start;
+	int retcode;
+
+	entry = runtime_info_vconf_batch_lookup(vconf_key, RUNTIME_INFO_DATA_TYPE_BOOL);
+
+	if (entry != NULL)
 	{
-		runtime_info_updated((runtime_info_key_e)event_data);
-	}		
+		*value = entry->value.b;
+		return entry->retcode;
+	}
+
+	start = RUNTIME_INFO_TRACE_CLOCK();
+	retcode = runtime_info_get_backend()->get_bool(vconf_key, value);
+	RUNTIME_INFO_TRACE3(vconf_read, vconf_key, retcode, RUNTIME_INFO_TRACE_CLOCK() - start);
+
+	entry = runtime_info_vconf_batch_record(vconf_key, RUNTIME_INFO_DATA_TYPE_BOOL, retcode);
+
+	if (entry != NULL && retcode == 0)
+	{
+		entry->value.b = *value;
+	}
+
+	return retcode;
 }
 
-static void runtime_info_vconf_event_cb3(keynode_t *node, void *event_data)
+int runtime_info_vconf_get_value_double(const char *vconf_key, double *value)
 {
-	if (node != NULL)
+	runtime_info_vconf_batch_entry_h entry;
+	unsigned long long start;
+	int retcode;
+
+	entry = runtime_info_vconf_batch_lookup(vconf_key, RUNTIME_INFO_DATA_TYPE_DOUBLE);
+
+	if (entry != NULL)
+	{
+		*value = entry->value.d;
+		return entry->retcode;
+	}
+
+	start = RUNTIME_INFO_TRACE_CLOCK();
+	retcode = runtime_info_get_backend()->get_double(vconf_key, value);
+	RUNTIME_INFO_TRACE3(vconf_read, vconf_key, retcode, RUNTIME_INFO_TRACE_CLOCK() - start);
+
+	entry = runtime_info_vconf_batch_record(vconf_key, RUNTIME_INFO_DATA_TYPE_DOUBLE, retcode);
+
+	if (entry != NULL && retcode == 0)
 	{
-		runtime_info_updated((runtime_info_key_e)event_data);
-	}		
+		entry->value.d = *value;
+	}
+
+	return retcode;
 }
 
-static void runtime_info_vconf_event_cb4(keynode_t *node, void *event_data)
+int runtime_info_vconf_get_value_string(const char *vconf_key, char **value)
 {
-	if (node != NULL)
+	runtime_info_vconf_batch_entry_h entry;
+	char *str_value = NULL;
+	unsigned long long start;
+	int retcode;
+
+	entry = runtime_info_vconf_batch_lookup(vconf_key, RUNTIME_INFO_DATA_TYPE_STRING);
+
+	if (entry != NULL)
 	{
-		runtime_info_updated((runtime_info_key_e)event_data);
-	}		
+		if (entry->retcode != 0)
+		{
+			return entry->retcode;
+		}
+
+		str_value = strdup(entry->value.s);
+	}
+	else
+	{
+		start = RUNTIME_INFO_TRACE_CLOCK();
+		retcode = runtime_info_get_backend()->get_string(vconf_key, &str_value);
+		RUNTIME_INFO_TRACE3(vconf_read, vconf_key, retcode, RUNTIME_INFO_TRACE_CLOCK() - start);
+
+		if (retcode)
+		{
+			str_value = NULL;
+		}
+
+		entry = runtime_info_vconf_batch_record(vconf_key, RUNTIME_INFO_DATA_TYPE_STRING, (str_value != NULL) ? 0 : -1);
+
+		if (entry != NULL && str_value != NULL)
+		{
+			entry->value.s = strdup(str_value);
+
+			if (entry->value.s == NULL)
+			{
+				entry->retcode = -1;
+			}
+		}
+	}
+
+	if (str_value != NULL)
+	{
+		*value = str_value;
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
 }
 
-static runtime_info_vconf_event_cb runtime_info_vconf_get_event_cb_slot(int slot)
+/*
+ * One backend watch is installed per vconf key, whatever the number of
+ * runtime information keys decoded from it; the notification is fanned out to
+ * every runtime information key currently watching that vconf key.
+ * Entries are never released, so at most one entry per runtime information key is needed.
+ * runtime_info_keys is read by the notification context while watches are set and unset, so it is only accessed atomically.
+ */
+typedef struct {
+	const char *vconf_key;
+	unsigned long long runtime_info_keys;
+} runtime_info_vconf_watch_s;
+
+typedef runtime_info_vconf_watch_s *runtime_info_vconf_watch_h;
+
+static runtime_info_vconf_watch_s runtime_info_vconf_watches[RUNTIME_INFO_KEY_COUNT];
+static int runtime_info_vconf_watch_count;
+
+static runtime_info_vconf_watch_h runtime_info_vconf_find_watch(const char *vconf_key, bool create)
 {
-	switch (slot)
+	runtime_info_vconf_watch_h watch;
+	int index;
+
+	for (index = 0; index < runtime_info_vconf_watch_count; index++)
 	{
-	case 0:
-		return runtime_info_vconf_event_cb0;
+		if (!strcmp(runtime_info_vconf_watches[index].vconf_key, vconf_key))
+		{
+			return &runtime_info_vconf_watches[index];
+		}
+	}
+
+	if (create == false || runtime_info_vconf_watch_count >= RUNTIME_INFO_KEY_COUNT)
+	{
+		return NULL;
+	}
 
-	case 1:
-		return runtime_info_vconf_event_cb1;
+	watch = &runtime_info_vconf_watches[runtime_info_vconf_watch_count++];
+	watch->vconf_key = vconf_key;
+	watch->runtime_info_keys = 0;
 
-	case 2:
-		return runtime_info_vconf_event_cb2;
+	return watch;
+}
 
-	case 3:
-		return runtime_info_vconf_event_cb3;
+void runtime_info_backend_changed(void *data)
+{
+	runtime_info_vconf_watch_h watch = data;
+	int key;
 
-	case 4:
-		return runtime_info_vconf_event_cb4;
+	if (watch == NULL)
+	{
+		return;
+	}
 
-	default:
-		return NULL;
+	RUNTIME_INFO_TRACE1(vconf_notify, watch->vconf_key);
+
+	for (key = 0; key < RUNTIME_INFO_KEY_COUNT; key++)
+	{
+		/* a callback may unwatch keys that are not dispatched yet */
+		if (__atomic_load_n(&watch->runtime_info_keys, __ATOMIC_ACQUIRE) & RUNTIME_INFO_KEY_BIT(key))
+		{
+			runtime_info_updated(key);
+		}
 	}
 }
 
-int runtime_info_vconf_set_event_cb (const char *vconf_key, runtime_info_key_e runtime_info_key, int slot)
+int runtime_info_vconf_set_event_cb(const char *vconf_key, runtime_info_key_e runtime_info_key)
 {
-	runtime_info_vconf_event_cb vconf_event_cb;
+	runtime_info_vconf_watch_h watch;
 
-	vconf_event_cb = runtime_info_vconf_get_event_cb_slot(slot);
+	watch = runtime_info_vconf_find_watch(vconf_key, true);
 
-	if (vconf_event_cb == NULL)
+	if (watch == NULL)
 	{
 		return RUNTIME_INFO_ERROR_IO_ERROR;
 	}
 
-	if (vconf_notify_key_changed(vconf_key, vconf_event_cb, (void*)runtime_info_key))
+	if (__atomic_load_n(&watch->runtime_info_keys, __ATOMIC_ACQUIRE) == 0)
 	{
-		return RUNTIME_INFO_ERROR_IO_ERROR;
+		if (runtime_info_get_backend()->watch(vconf_key, watch))
+		{
+			return RUNTIME_INFO_ERROR_IO_ERROR;
+		}
 	}
 
+	__atomic_fetch_or(&watch->runtime_info_keys, RUNTIME_INFO_KEY_BIT(runtime_info_key), __ATOMIC_RELEASE);
+
 	return RUNTIME_INFO_ERROR_NONE;
 }
 
-void runtime_info_vconf_unset_event_cb (const char *vconf_key, int slot)
+void runtime_info_vconf_unset_event_cb(const char *vconf_key, runtime_info_key_e runtime_info_key)
 {
-	runtime_info_vconf_event_cb vconf_event_cb;
+	runtime_info_vconf_watch_h watch;
 
-	vconf_event_cb = runtime_info_vconf_get_event_cb_slot(slot);
+	watch = runtime_info_vconf_find_watch(vconf_key, false);
 
-	if (vconf_event_cb != NULL)
+	if (watch == NULL || !(__atomic_load_n(&watch->runtime_info_keys, __ATOMIC_ACQUIRE) & RUNTIME_INFO_KEY_BIT(runtime_info_key)))
 	{
-		vconf_ignore_key_changed(vconf_key, vconf_event_cb);
+		return;
 	}
-}
 
+	if ((__atomic_fetch_and(&watch->runtime_info_keys, ~RUNTIME_INFO_KEY_BIT(runtime_info_key), __ATOMIC_ACQ_REL)
+		& ~RUNTIME_INFO_KEY_BIT(runtime_info_key)) == 0)
+	{
+		runtime_info_get_backend()->unwatch(vconf_key);
+	}
+}
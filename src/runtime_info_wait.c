@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <vconf.h>
+#include <dlog.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+#ifdef LOG_TAG
+#undef LOG_TAG
+#endif
+
+#define LOG_TAG "TIZEN_N_RUNTIME_INFO"
+
+/*
+ * Waiters of a key share one internal subscription, made by the first waiter and cancelled by the last.
+ * Its callback only bumps the generation of the key and wakes every waiter, so that a callback still
+ * running after runtime_info_unsubscribe() returns never touches the stack of a waiter that has left.
+ */
+static pthread_mutex_t runtime_info_wait_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t runtime_info_wait_cond;
+static pthread_once_t runtime_info_wait_once = PTHREAD_ONCE_INIT;
+static unsigned int runtime_info_wait_generations[RUNTIME_INFO_KEY_COUNT];
+static int runtime_info_wait_waiters[RUNTIME_INFO_KEY_COUNT];
+static runtime_info_subscription_h runtime_info_wait_subscriptions[RUNTIME_INFO_KEY_COUNT];
+
+static void runtime_info_wait_init(void)
+{
+	pthread_condattr_t condattr;
+
+	pthread_condattr_init(&condattr);
+	pthread_condattr_setclock(&condattr, CLOCK_MONOTONIC);
+	pthread_cond_init(&runtime_info_wait_cond, &condattr);
+	pthread_condattr_destroy(&condattr);
+}
+
+static void runtime_info_wait_changed_cb(runtime_info_key_e key, void *user_data)
+{
+	pthread_mutex_lock(&runtime_info_wait_mutex);
+
+	runtime_info_wait_generations[key]++;
+	pthread_cond_broadcast(&runtime_info_wait_cond);
+
+	pthread_mutex_unlock(&runtime_info_wait_mutex);
+}
+
+static int runtime_info_wait_enter(runtime_info_key_e key)
+{
+	int retcode = RUNTIME_INFO_ERROR_NONE;
+
+	pthread_mutex_lock(&runtime_info_wait_mutex);
+
+	if (runtime_info_wait_waiters[key] == 0)
+	{
+		retcode = runtime_info_subscribe(key, runtime_info_wait_changed_cb, NULL, &runtime_info_wait_subscriptions[key]);
+	}
+
+	if (retcode == RUNTIME_INFO_ERROR_NONE)
+	{
+		runtime_info_wait_waiters[key]++;
+	}
+
+	pthread_mutex_unlock(&runtime_info_wait_mutex);
+
+	return retcode;
+}
+
+static void runtime_info_wait_leave(runtime_info_key_e key)
+{
+	pthread_mutex_lock(&runtime_info_wait_mutex);
+
+	if (--runtime_info_wait_waiters[key] == 0)
+	{
+		runtime_info_unsubscribe(runtime_info_wait_subscriptions[key]);
+		runtime_info_wait_subscriptions[key] = NULL;
+	}
+
+	pthread_mutex_unlock(&runtime_info_wait_mutex);
+}
+
+static bool runtime_info_wait_check(runtime_info_key_e key, runtime_info_data_type_e data_type, runtime_info_value_predicate_cb predicate, void *user_data)
+{
+	runtime_info_value_u value;
+	bool satisfied;
+
+	if (runtime_info_get_value(key, data_type, &value) != RUNTIME_INFO_ERROR_NONE)
+	{
+		return false;
+	}
+
+	satisfied = predicate(key, &value, user_data);
+
+	if (data_type == RUNTIME_INFO_DATA_TYPE_STRING)
+	{
+		free(value.s);
+	}
+
+	return satisfied;
+}
+
+int runtime_info_wait_for(runtime_info_key_e key, runtime_info_value_predicate_cb predicate, void *user_data, int timeout_ms)
+{
+	runtime_info_data_type_e data_type;
+	unsigned long long deadline_ns = 0;
+	unsigned int generation;
+	struct timespec timeout;
+	int retcode;
+
+	if (runtime_info_get_data_type(key, &data_type))
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	if (predicate == NULL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid predicate", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	pthread_once(&runtime_info_wait_once, runtime_info_wait_init);
+
+	if (timeout_ms >= 0)
+	{
+		deadline_ns = runtime_info_get_monotonic_ns() + (unsigned long long)timeout_ms * 1000000ULL;
+		timeout.tv_sec = deadline_ns / 1000000000ULL;
+		timeout.tv_nsec = deadline_ns % 1000000000ULL;
+	}
+
+	retcode = runtime_info_wait_enter(key);
+
+	if (retcode != RUNTIME_INFO_ERROR_NONE)
+	{
+		LOGE("[%s] IO_ERROR(0x%08x) : failed to watch the key(%d)", __FUNCTION__, retcode, key);
+		return retcode;
+	}
+
+	/* The generation is sampled before each read, so a change landing during the read is not missed */
+	while (1)
+	{
+		pthread_mutex_lock(&runtime_info_wait_mutex);
+		generation = runtime_info_wait_generations[key];
+		pthread_mutex_unlock(&runtime_info_wait_mutex);
+
+		if (runtime_info_wait_check(key, data_type, predicate, user_data))
+		{
+			break;
+		}
+
+		pthread_mutex_lock(&runtime_info_wait_mutex);
+
+		while (runtime_info_wait_generations[key] == generation && retcode == RUNTIME_INFO_ERROR_NONE)
+		{
+			if (timeout_ms < 0)
+			{
+				pthread_cond_wait(&runtime_info_wait_cond, &runtime_info_wait_mutex);
+			}
+			else if (pthread_cond_timedwait(&runtime_info_wait_cond, &runtime_info_wait_mutex, &timeout))
+			{
+				retcode = RUNTIME_INFO_ERROR_TIMED_OUT;
+			}
+		}
+
+		pthread_mutex_unlock(&runtime_info_wait_mutex);
+
+		if (retcode != RUNTIME_INFO_ERROR_NONE)
+		{
+			break;
+		}
+	}
+
+	runtime_info_wait_leave(key);
+
+	return retcode;
+}
+
+static bool runtime_info_wait_int_equal(runtime_info_key_e key, const runtime_info_value_u *value, void *user_data)
+{
+	return value->i == *(int *)user_data;
+}
+
+static bool runtime_info_wait_bool_equal(runtime_info_key_e key, const runtime_info_value_u *value, void *user_data)
+{
+	return value->b == *(bool *)user_data;
+}
+
+int runtime_info_wait_for_value_int(runtime_info_key_e key, int value, int timeout_ms)
+{
+	runtime_info_data_type_e data_type;
+
+	if (runtime_info_get_data_type(key, &data_type) || data_type != RUNTIME_INFO_DATA_TYPE_INT)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	return runtime_info_wait_for(key, runtime_info_wait_int_equal, &value, timeout_ms);
+}
+
+int runtime_info_wait_for_value_bool(runtime_info_key_e key, bool value, int timeout_ms)
+{
+	runtime_info_data_type_e data_type;
+
+	if (runtime_info_get_data_type(key, &data_type) || data_type != RUNTIME_INFO_DATA_TYPE_BOOL)
+	{
+		LOGE("[%s] INVALID_PARAMETER(0x%08x) : invalid key", __FUNCTION__, RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+		return RUNTIME_INFO_ERROR_INVALID_PARAMETER;
+	}
+
+	return runtime_info_wait_for(key, runtime_info_wait_bool_equal, &value, timeout_ms);
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Stand-in for the dlog header: errors go to stderr, other levels are discarded.
+ */
+
+#ifndef __DLOG_H__
+#define __DLOG_H__
+
+#include <stdio.h>
+
+#define LOGE(fmt, arg...) fprintf(stderr, "E/%s: " fmt "\n", LOG_TAG, ##arg)
+#define LOGW(fmt, arg...) do { } while (0)
+#define LOGI(fmt, arg...) do { } while (0)
+#define LOGD(fmt, arg...) do { } while (0)
+
+#endif /* __DLOG_H__ */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Stand-in for the capi-base-common header, for builds on hosts without the Tizen platform packages.
+ */
+
+#ifndef __TIZEN_H__
+#define __TIZEN_H__
+
+#include <stdbool.h>
+#include <errno.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define TIZEN_ERROR_MIN_PLATFORM_ERROR (-1073741824LL)
+
+typedef enum
+{
+	TIZEN_ERROR_NONE = 0,
+	TIZEN_ERROR_INVALID_PARAMETER = -EINVAL,
+	TIZEN_ERROR_OUT_OF_MEMORY = -ENOMEM,
+	TIZEN_ERROR_IO_ERROR = -EIO,
+	TIZEN_ERROR_RESOURCE_BUSY = -EBUSY,
+	TIZEN_ERROR_PERMISSION_DENIED = -EACCES,
+	TIZEN_ERROR_NOT_SUPPORTED = -ENOTSUP,
+	TIZEN_ERROR_UNKNOWN = TIZEN_ERROR_MIN_PLATFORM_ERROR,
+	TIZEN_ERROR_TIMED_OUT,
+} tizen_error_e;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TIZEN_H__ */
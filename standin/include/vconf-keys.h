@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * The vconf keys and values read by the library, as defined by the platform.
+ */
+
+#ifndef __VCONF_KEYS_H__
+#define __VCONF_KEYS_H__
+
+#define VCONFKEY_3G_ENABLE "db/setting/3gEnabled"
+
+#define VCONFKEY_BT_STATUS "db/bluetooth/status"
+enum {
+	VCONFKEY_BT_STATUS_OFF = 0x0000,
+	VCONFKEY_BT_STATUS_ON = 0x0001,
+	VCONFKEY_BT_STATUS_BT_VISIBLE = 0x0002,
+	VCONFKEY_BT_STATUS_TRANSFER = 0x0004,
+};
+
+#define VCONFKEY_LANGSET "db/menu_widget/language"
+#define VCONFKEY_REGIONFORMAT "db/menu_widget/regionformat"
+
+#define VCONFKEY_LOCATION_GPS_STATE "memory/location/gps/state"
+enum {
+	VCONFKEY_LOCATION_GPS_OFF = 0,
+	VCONFKEY_LOCATION_GPS_SEARCHING,
+	VCONFKEY_LOCATION_GPS_CONNECTED,
+};
+
+#define VCONFKEY_MOBILE_HOTSPOT_MODE "memory/mobile_hotspot/mode"
+enum {
+	VCONFKEY_MOBILE_HOTSPOT_MODE_NONE = 0,
+	VCONFKEY_MOBILE_HOTSPOT_MODE_WIFI = 0x01,
+	VCONFKEY_MOBILE_HOTSPOT_MODE_USB = 0x02,
+	VCONFKEY_MOBILE_HOTSPOT_MODE_BT = 0x04,
+};
+
+#define VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL "db/telephony/flight_mode"
+#define VCONFKEY_SETAPPL_ROTATE_LOCK_BOOL "db/setting/rotate_lock"
+#define VCONFKEY_SETAPPL_TOUCH_FEEDBACK_VIBRATION_LEVEL_INT "db/setting/sound/touch_feedback/vibration_level"
+
+#define VCONFKEY_SYSMAN_BATTERY_CHARGE_NOW "memory/sysman/battery_charge_now"
+
+#define VCONFKEY_SYSMAN_CHARGER_STATUS "memory/sysman/charger_status"
+enum {
+	VCONFKEY_SYSMAN_CHARGER_DISCONNECTED = 0,
+	VCONFKEY_SYSMAN_CHARGER_CONNECTED,
+};
+
+#define VCONFKEY_SYSMAN_EARJACK "memory/sysman/earjack"
+enum {
+	VCONFKEY_SYSMAN_EARJACK_REMOVED = 0,
+	VCONFKEY_SYSMAN_EARJACK_3WIRE = 1,
+	VCONFKEY_SYSMAN_EARJACK_4WIRE = 3,
+	VCONFKEY_SYSMAN_EARJACK_TVOUT = 0x10,
+};
+
+#define VCONFKEY_SYSMAN_SLIDING_KEYBOARD "memory/sysman/sliding_keyboard"
+enum {
+	VCONFKEY_SYSMAN_SLIDING_KEYBOARD_NOT_SUPPORTED = -1,
+	VCONFKEY_SYSMAN_SLIDING_KEYBOARD_NOT_AVAILABE = 0,
+	VCONFKEY_SYSMAN_SLIDING_KEYBOAED_AVAILABLE = 1,
+};
+
+#define VCONFKEY_SYSMAN_USB_STATUS "memory/sysman/usb_status"
+enum {
+	VCONFKEY_SYSMAN_USB_DISCONNECTED = 0,
+	VCONFKEY_SYSMAN_USB_CONNECTED,
+	VCONFKEY_SYSMAN_USB_AVAILABLE,
+};
+
+enum {
+	VCONFKEY_TIME_FORMAT_12 = 1,
+	VCONFKEY_TIME_FORMAT_24,
+};
+
+enum {
+	SETTING_WEEKOFDAY_FORMAT_SUNDAY = 0,
+	SETTING_WEEKOFDAY_FORMAT_MONDAY,
+	SETTING_WEEKOFDAY_FORMAT_TUESDAY,
+	SETTING_WEEKOFDAY_FORMAT_WEDNESDAY,
+	SETTING_WEEKOFDAY_FORMAT_THURSDAY,
+	SETTING_WEEKOFDAY_FORMAT_FRIDAY,
+	SETTING_WEEKOFDAY_FORMAT_SATURDAY,
+};
+
+#define VCONFKEY_WIFI_STATE "memory/wifi/state"
+enum {
+	VCONFKEY_WIFI_OFF = 0x00,
+	VCONFKEY_WIFI_UNCONNECTED,
+	VCONFKEY_WIFI_CONNECTED,
+	VCONFKEY_WIFI_TRANSFER,
+};
+
+#endif /* __VCONF_KEYS_H__ */
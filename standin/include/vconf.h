@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Stand-in for the subset of vconf used by the library.
+ * Values live in memory, or in one file per key under the directory named by VCONF_STANDIN_DIR.
+ * With the file store, changes made by any process are notified through inotify.
+ */
+
+#ifndef __VCONF_H__
+#define __VCONF_H__
+
+#include <vconf-keys.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define VCONF_OK 0
+#define VCONF_ERROR -1
+
+enum {
+	VCONF_TYPE_NONE = 0,
+	VCONF_TYPE_STRING = 40,
+	VCONF_TYPE_INT = 41,
+	VCONF_TYPE_DOUBLE = 42,
+	VCONF_TYPE_BOOL = 43,
+};
+
+typedef struct _keynode_t keynode_t;
+
+typedef void (*vconf_callback_fn) (keynode_t *node, void *user_data);
+
+int vconf_get_int(const char *in_key, int *intval);
+int vconf_get_bool(const char *in_key, int *boolval);
+int vconf_get_dbl(const char *in_key, double *dblval);
+char *vconf_get_str(const char *in_key);
+
+int vconf_set_int(const char *in_key, const int intval);
+int vconf_set_bool(const char *in_key, const int boolval);
+int vconf_set_dbl(const char *in_key, const double dblval);
+int vconf_set_str(const char *in_key, const char *strval);
+
+int vconf_notify_key_changed(const char *in_key, vconf_callback_fn cb, void *user_data);
+int vconf_ignore_key_changed(const char *in_key, vconf_callback_fn cb);
+
+char *vconf_keynode_get_name(keynode_t *keynode);
+int vconf_keynode_get_type(keynode_t *keynode);
+int vconf_keynode_get_int(const keynode_t *keynode);
+int vconf_keynode_get_bool(const keynode_t *keynode);
+double vconf_keynode_get_dbl(const keynode_t *keynode);
+char *vconf_keynode_get_str(const keynode_t *keynode);
+
+/* stand-in only: while a key is stalled, its reads block until it is released, as a hung backend would */
+int vconf_standin_stall_key(const char *in_key, int stall);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VCONF_H__ */
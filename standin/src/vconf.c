@@ -0,0 +1,732 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/inotify.h>
+
+#include <vconf.h>
+
+#define VCONF_STANDIN_BUCKETS 64
+#define VCONF_STANDIN_PATH_MAX 4096
+#define VCONF_STANDIN_LINE_MAX 4096
+
+struct _keynode_t {
+	char *keyname;
+	int type;
+	union {
+		int i;
+		int b;
+		double d;
+		char *s;
+	} value;
+	struct _keynode_t *next;
+};
+
+typedef struct vconf_standin_watch_s {
+	char *key;
+	vconf_callback_fn cb;
+	void *user_data;
+	struct vconf_standin_watch_s *next;
+} vconf_standin_watch_s;
+
+typedef struct {
+	vconf_callback_fn cb;
+	void *user_data;
+} vconf_standin_callback_s;
+
+static pthread_mutex_t vconf_standin_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t vconf_standin_stall_cond = PTHREAD_COND_INITIALIZER;
+static char *vconf_standin_stalled_key;
+static pthread_once_t vconf_standin_once = PTHREAD_ONCE_INIT;
+static keynode_t *vconf_standin_buckets[VCONF_STANDIN_BUCKETS];
+static vconf_standin_watch_s *vconf_standin_watches;
+static const char *vconf_standin_dir;
+static int vconf_standin_inotify_fd = -1;
+
+static void vconf_standin_init(void)
+{
+	vconf_standin_dir = getenv("VCONF_STANDIN_DIR");
+}
+
+static unsigned int vconf_standin_hash(const char *key)
+{
+	unsigned int hash = 2166136261u;
+
+	while (*key != '\0')
+	{
+		hash = (hash ^ (unsigned char)*key++) * 16777619u;
+	}
+
+	return hash % VCONF_STANDIN_BUCKETS;
+}
+
+/* called with vconf_standin_mutex held */
+static keynode_t *vconf_standin_lookup(const char *key, bool create)
+{
+	unsigned int hash = vconf_standin_hash(key);
+	keynode_t *node;
+
+	for (node = vconf_standin_buckets[hash]; node != NULL; node = node->next)
+	{
+		if (!strcmp(node->keyname, key))
+		{
+			return node;
+		}
+	}
+
+	if (create == false)
+	{
+		return NULL;
+	}
+
+	node = calloc(1, sizeof(keynode_t));
+
+	if (node == NULL)
+	{
+		return NULL;
+	}
+
+	node->keyname = strdup(key);
+
+	if (node->keyname == NULL)
+	{
+		free(node);
+		return NULL;
+	}
+
+	node->next = vconf_standin_buckets[hash];
+	vconf_standin_buckets[hash] = node;
+
+	return node;
+}
+
+/* a key is stored in a file named after it, with its slashes replaced by dots */
+static void vconf_standin_file_name(const char *key, char *name, size_t size)
+{
+	size_t index;
+
+	for (index = 0; key[index] != '\0' && index + 1 < size; index++)
+	{
+		name[index] = (key[index] == '/') ? '.' : key[index];
+	}
+
+	name[index] = '\0';
+}
+
+static void vconf_standin_file_path(const char *key, char *path, size_t size)
+{
+	char name[VCONF_STANDIN_PATH_MAX];
+
+	vconf_standin_file_name(key, name, sizeof(name));
+	snprintf(path, size, "%s/%s", vconf_standin_dir, name);
+}
+
+/*
+ * A file holds one line: a type letter (i, b, d or s), a space and the value.
+ */
+static int vconf_standin_file_read(const char *key, keynode_t *node)
+{
+	char path[VCONF_STANDIN_PATH_MAX];
+	char line[VCONF_STANDIN_LINE_MAX];
+	FILE *fp;
+	char *end;
+
+	vconf_standin_file_path(key, path, sizeof(path));
+
+	fp = fopen(path, "r");
+
+	if (fp == NULL)
+	{
+		return VCONF_ERROR;
+	}
+
+	if (fgets(line, sizeof(line), fp) == NULL || strlen(line) < 2 || line[1] != ' ')
+	{
+		fclose(fp);
+		return VCONF_ERROR;
+	}
+
+	fclose(fp);
+
+	line[strcspn(line, "\n")] = '\0';
+
+	switch (line[0])
+	{
+	case 'i':
+		node->type = VCONF_TYPE_INT;
+		node->value.i = strtol(line + 2, &end, 10);
+		break;
+
+	case 'b':
+		node->type = VCONF_TYPE_BOOL;
+		node->value.b = strtol(line + 2, &end, 10) ? 1 : 0;
+		break;
+
+	case 'd':
+		node->type = VCONF_TYPE_DOUBLE;
+		node->value.d = strtod(line + 2, &end);
+		break;
+
+	case 's':
+		node->type = VCONF_TYPE_STRING;
+		node->value.s = strdup(line + 2);
+		return (node->value.s != NULL) ? VCONF_OK : VCONF_ERROR;
+
+	default:
+		return VCONF_ERROR;
+	}
+
+	return (end != line + 2) ? VCONF_OK : VCONF_ERROR;
+}
+
+/* the value is written to a temporary file and renamed, so that readers never see a partial value */
+static int vconf_standin_file_write(const keynode_t *node)
+{
+	char path[VCONF_STANDIN_PATH_MAX];
+	char temp_path[VCONF_STANDIN_PATH_MAX + 8];
+	FILE *fp;
+	int written;
+
+	vconf_standin_file_path(node->keyname, path, sizeof(path));
+	snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+
+	fp = fopen(temp_path, "w");
+
+	if (fp == NULL)
+	{
+		return VCONF_ERROR;
+	}
+
+	switch (node->type)
+	{
+	case VCONF_TYPE_INT:
+		written = fprintf(fp, "i %d\n", node->value.i);
+		break;
+
+	case VCONF_TYPE_BOOL:
+		written = fprintf(fp, "b %d\n", node->value.b);
+		break;
+
+	case VCONF_TYPE_DOUBLE:
+		written = fprintf(fp, "d %.17g\n", node->value.d);
+		break;
+
+	default:
+		written = fprintf(fp, "s %s\n", node->value.s);
+		break;
+	}
+
+	if (fclose(fp) != 0 || written < 0 || rename(temp_path, path) != 0)
+	{
+		unlink(temp_path);
+		return VCONF_ERROR;
+	}
+
+	return VCONF_OK;
+}
+
+int vconf_standin_stall_key(const char *in_key, int stall)
+{
+	char *key = NULL;
+
+	if (stall && (in_key == NULL || (key = strdup(in_key)) == NULL))
+	{
+		return VCONF_ERROR;
+	}
+
+	pthread_mutex_lock(&vconf_standin_mutex);
+
+	free(vconf_standin_stalled_key);
+	vconf_standin_stalled_key = key;
+	pthread_cond_broadcast(&vconf_standin_stall_cond);
+
+	pthread_mutex_unlock(&vconf_standin_mutex);
+
+	return VCONF_OK;
+}
+
+static void vconf_standin_wait_stall(const char *key)
+{
+	pthread_mutex_lock(&vconf_standin_mutex);
+
+	while (vconf_standin_stalled_key != NULL && !strcmp(vconf_standin_stalled_key, key))
+	{
+		pthread_cond_wait(&vconf_standin_stall_cond, &vconf_standin_mutex);
+	}
+
+	pthread_mutex_unlock(&vconf_standin_mutex);
+}
+
+/* copies the value of key into node, whose string is then owned by the caller */
+static int vconf_standin_get(const char *key, int type, keynode_t *node)
+{
+	keynode_t *stored;
+	int retcode = VCONF_OK;
+
+	if (key == NULL)
+	{
+		return VCONF_ERROR;
+	}
+
+	pthread_once(&vconf_standin_once, vconf_standin_init);
+	vconf_standin_wait_stall(key);
+
+	if (vconf_standin_dir != NULL)
+	{
+		retcode = vconf_standin_file_read(key, node);
+	}
+	else
+	{
+		pthread_mutex_lock(&vconf_standin_mutex);
+
+		stored = vconf_standin_lookup(key, false);
+
+		if (stored == NULL)
+		{
+			retcode = VCONF_ERROR;
+		}
+		else
+		{
+			node->type = stored->type;
+			node->value = stored->value;
+
+			if (stored->type == VCONF_TYPE_STRING)
+			{
+				node->value.s = strdup(stored->value.s);
+				retcode = (node->value.s != NULL) ? VCONF_OK : VCONF_ERROR;
+			}
+		}
+
+		pthread_mutex_unlock(&vconf_standin_mutex);
+	}
+
+	if (retcode == VCONF_OK && type != VCONF_TYPE_NONE && node->type != type)
+	{
+		if (node->type == VCONF_TYPE_STRING)
+		{
+			free(node->value.s);
+		}
+
+		retcode = VCONF_ERROR;
+	}
+
+	return retcode;
+}
+
+/*
+ * Invokes the callbacks registered on key, or on the key stored in the file named file_name.
+ * The callbacks run with no lock held, so that they can read, set, watch and ignore keys.
+ */
+static void vconf_standin_notify(const char *key, const char *file_name)
+{
+	vconf_standin_watch_s *watch;
+	vconf_standin_callback_s *callbacks = NULL;
+	vconf_standin_callback_s *grown;
+	char name[VCONF_STANDIN_PATH_MAX];
+	char *node_key = NULL;
+	keynode_t node;
+	int count = 0;
+	int index;
+
+	pthread_mutex_lock(&vconf_standin_mutex);
+
+	for (watch = vconf_standin_watches; watch != NULL; watch = watch->next)
+	{
+		if (file_name != NULL)
+		{
+			vconf_standin_file_name(watch->key, name, sizeof(name));
+
+			if (strcmp(name, file_name) || (node_key != NULL && strcmp(node_key, watch->key)))
+			{
+				continue;
+			}
+		}
+		else if (strcmp(watch->key, key))
+		{
+			continue;
+		}
+
+		grown = realloc(callbacks, (count + 1) * sizeof(vconf_standin_callback_s));
+
+		if (grown == NULL)
+		{
+			break;
+		}
+
+		callbacks = grown;
+		callbacks[count].cb = watch->cb;
+		callbacks[count].user_data = watch->user_data;
+		count++;
+
+		if (node_key == NULL)
+		{
+			node_key = strdup(watch->key);
+		}
+	}
+
+	pthread_mutex_unlock(&vconf_standin_mutex);
+
+	for (index = 0; index < count && node_key != NULL; index++)
+	{
+		memset(&node, 0, sizeof(node));
+		node.keyname = node_key;
+
+		if (vconf_standin_get(node_key, VCONF_TYPE_NONE, &node) != VCONF_OK)
+		{
+			node.type = VCONF_TYPE_NONE;
+		}
+
+		callbacks[index].cb(&node, callbacks[index].user_data);
+
+		if (node.type == VCONF_TYPE_STRING)
+		{
+			free(node.value.s);
+		}
+	}
+
+	free(node_key);
+	free(callbacks);
+}
+
+static int vconf_standin_set(const char *key, const keynode_t *value)
+{
+	keynode_t *stored;
+	char *str_value = NULL;
+
+	if (key == NULL || (value->type == VCONF_TYPE_STRING && value->value.s == NULL))
+	{
+		return VCONF_ERROR;
+	}
+
+	pthread_once(&vconf_standin_once, vconf_standin_init);
+
+	if (vconf_standin_dir != NULL)
+	{
+		keynode_t node = *value;
+
+		node.keyname = (char *)key;
+
+		/* the change is notified by the inotify watch, for this process and any other */
+		return vconf_standin_file_write(&node);
+	}
+
+	if (value->type == VCONF_TYPE_STRING)
+	{
+		str_value = strdup(value->value.s);
+
+		if (str_value == NULL)
+		{
+			return VCONF_ERROR;
+		}
+	}
+
+	pthread_mutex_lock(&vconf_standin_mutex);
+
+	stored = vconf_standin_lookup(key, true);
+
+	if (stored == NULL)
+	{
+		pthread_mutex_unlock(&vconf_standin_mutex);
+		free(str_value);
+		return VCONF_ERROR;
+	}
+
+	if (stored->type == VCONF_TYPE_STRING)
+	{
+		free(stored->value.s);
+	}
+
+	stored->type = value->type;
+	stored->value = value->value;
+
+	if (value->type == VCONF_TYPE_STRING)
+	{
+		stored->value.s = str_value;
+	}
+
+	pthread_mutex_unlock(&vconf_standin_mutex);
+
+	vconf_standin_notify(key, NULL);
+
+	return VCONF_OK;
+}
+
+int vconf_get_int(const char *in_key, int *intval)
+{
+	keynode_t node;
+
+	if (intval == NULL || vconf_standin_get(in_key, VCONF_TYPE_INT, &node) != VCONF_OK)
+	{
+		return VCONF_ERROR;
+	}
+
+	*intval = node.value.i;
+
+	return VCONF_OK;
+}
+
+int vconf_get_bool(const char *in_key, int *boolval)
+{
+	keynode_t node;
+
+	if (boolval == NULL || vconf_standin_get(in_key, VCONF_TYPE_BOOL, &node) != VCONF_OK)
+	{
+		return VCONF_ERROR;
+	}
+
+	*boolval = node.value.b;
+
+	return VCONF_OK;
+}
+
+int vconf_get_dbl(const char *in_key, double *dblval)
+{
+	keynode_t node;
+
+	if (dblval == NULL || vconf_standin_get(in_key, VCONF_TYPE_DOUBLE, &node) != VCONF_OK)
+	{
+		return VCONF_ERROR;
+	}
+
+	*dblval = node.value.d;
+
+	return VCONF_OK;
+}
+
+char *vconf_get_str(const char *in_key)
+{
+	keynode_t node;
+
+	if (vconf_standin_get(in_key, VCONF_TYPE_STRING, &node) != VCONF_OK)
+	{
+		return NULL;
+	}
+
+	return node.value.s;
+}
+
+int vconf_set_int(const char *in_key, const int intval)
+{
+	keynode_t node = { .type = VCONF_TYPE_INT, .value.i = intval };
+
+	return vconf_standin_set(in_key, &node);
+}
+
+int vconf_set_bool(const char *in_key, const int boolval)
+{
+	keynode_t node = { .type = VCONF_TYPE_BOOL, .value.b = boolval ? 1 : 0 };
+
+	return vconf_standin_set(in_key, &node);
+}
+
+int vconf_set_dbl(const char *in_key, const double dblval)
+{
+	keynode_t node = { .type = VCONF_TYPE_DOUBLE, .value.d = dblval };
+
+	return vconf_standin_set(in_key, &node);
+}
+
+int vconf_set_str(const char *in_key, const char *strval)
+{
+	keynode_t node = { .type = VCONF_TYPE_STRING, .value.s = (char *)strval };
+
+	return vconf_standin_set(in_key, &node);
+}
+
+static void *vconf_standin_inotify_thread(void *data)
+{
+	char buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+	const struct inotify_event *event;
+	ssize_t length;
+	char *ptr;
+
+	while (1)
+	{
+		length = read(vconf_standin_inotify_fd, buffer, sizeof(buffer));
+
+		if (length < 0 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (length <= 0)
+		{
+			break;
+		}
+
+		for (ptr = buffer; ptr < buffer + length; ptr += sizeof(struct inotify_event) + event->len)
+		{
+			event = (const struct inotify_event *)ptr;
+
+			if (event->len > 0)
+			{
+				vconf_standin_notify(NULL, event->name);
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/* called with vconf_standin_mutex held */
+static int vconf_standin_start_inotify(void)
+{
+	pthread_t thread;
+
+	if (vconf_standin_inotify_fd >= 0)
+	{
+		return VCONF_OK;
+	}
+
+	vconf_standin_inotify_fd = inotify_init1(IN_CLOEXEC);
+
+	if (vconf_standin_inotify_fd < 0)
+	{
+		return VCONF_ERROR;
+	}
+
+	if (inotify_add_watch(vconf_standin_inotify_fd, vconf_standin_dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0
+		|| pthread_create(&thread, NULL, vconf_standin_inotify_thread, NULL))
+	{
+		close(vconf_standin_inotify_fd);
+		vconf_standin_inotify_fd = -1;
+		return VCONF_ERROR;
+	}
+
+	pthread_detach(thread);
+
+	return VCONF_OK;
+}
+
+int vconf_notify_key_changed(const char *in_key, vconf_callback_fn cb, void *user_data)
+{
+	vconf_standin_watch_s *watch;
+
+	if (in_key == NULL || cb == NULL)
+	{
+		return VCONF_ERROR;
+	}
+
+	pthread_once(&vconf_standin_once, vconf_standin_init);
+
+	watch = calloc(1, sizeof(vconf_standin_watch_s));
+
+	if (watch == NULL)
+	{
+		return VCONF_ERROR;
+	}
+
+	watch->key = strdup(in_key);
+
+	if (watch->key == NULL)
+	{
+		free(watch);
+		return VCONF_ERROR;
+	}
+
+	watch->cb = cb;
+	watch->user_data = user_data;
+
+	pthread_mutex_lock(&vconf_standin_mutex);
+
+	if (vconf_standin_dir != NULL && vconf_standin_start_inotify() != VCONF_OK)
+	{
+		pthread_mutex_unlock(&vconf_standin_mutex);
+		free(watch->key);
+		free(watch);
+		return VCONF_ERROR;
+	}
+
+	watch->next = vconf_standin_watches;
+	vconf_standin_watches = watch;
+
+	pthread_mutex_unlock(&vconf_standin_mutex);
+
+	return VCONF_OK;
+}
+
+int vconf_ignore_key_changed(const char *in_key, vconf_callback_fn cb)
+{
+	vconf_standin_watch_s **link;
+	vconf_standin_watch_s *watch;
+	int retcode = VCONF_ERROR;
+
+	if (in_key == NULL || cb == NULL)
+	{
+		return VCONF_ERROR;
+	}
+
+	pthread_mutex_lock(&vconf_standin_mutex);
+
+	link = &vconf_standin_watches;
+
+	while (*link != NULL)
+	{
+		watch = *link;
+
+		if (watch->cb == cb && !strcmp(watch->key, in_key))
+		{
+			*link = watch->next;
+			free(watch->key);
+			free(watch);
+			retcode = VCONF_OK;
+		}
+		else
+		{
+			link = &watch->next;
+		}
+	}
+
+	pthread_mutex_unlock(&vconf_standin_mutex);
+
+	return retcode;
+}
+
+char *vconf_keynode_get_name(keynode_t *keynode)
+{
+	return (keynode != NULL) ? keynode->keyname : NULL;
+}
+
+int vconf_keynode_get_type(keynode_t *keynode)
+{
+	return (keynode != NULL) ? keynode->type : VCONF_ERROR;
+}
+
+int vconf_keynode_get_int(const keynode_t *keynode)
+{
+	return (keynode != NULL && keynode->type == VCONF_TYPE_INT) ? keynode->value.i : VCONF_ERROR;
+}
+
+int vconf_keynode_get_bool(const keynode_t *keynode)
+{
+	return (keynode != NULL && keynode->type == VCONF_TYPE_BOOL) ? keynode->value.b : VCONF_ERROR;
+}
+
+double vconf_keynode_get_dbl(const keynode_t *keynode)
+{
+	return (keynode != NULL && keynode->type == VCONF_TYPE_DOUBLE) ? keynode->value.d : VCONF_ERROR;
+}
+
+char *vconf_keynode_get_str(const keynode_t *keynode)
+{
+	return (keynode != NULL && keynode->type == VCONF_TYPE_STRING) ? keynode->value.s : NULL;
+}
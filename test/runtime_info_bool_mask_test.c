@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Checks that the bits of runtime_info_get_bool_mask() follow the changes of the system,
+ * including after a callback registered on one of the keys was removed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+#define VCONF_VIBRATION_ENABLED "db/setting/sound/vibration_on"
+#define BIT(key) (1ULL << (key))
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+static void changed_cb(runtime_info_key_e key, void *user_data)
+{
+}
+
+static unsigned long long get_bits(unsigned long long mask)
+{
+	unsigned long long bits = ~0ULL;
+
+	CHECK(runtime_info_get_bool_mask(mask, &bits) == RUNTIME_INFO_ERROR_NONE);
+
+	return bits;
+}
+
+int main(void)
+{
+	unsigned long long mask = BIT(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED) | BIT(RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED)
+		| BIT(RUNTIME_INFO_KEY_VIBRATION_ENABLED);
+	runtime_info_subscription_h subscription;
+	runtime_info_stats_s stats;
+	unsigned long long bits;
+
+	vconf_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 1);
+	vconf_set_bool(VCONFKEY_SETAPPL_ROTATE_LOCK_BOOL, 0);
+	vconf_set_bool(VCONF_VIBRATION_ENABLED, 1);
+
+	CHECK(get_bits(mask) == (BIT(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED) | BIT(RUNTIME_INFO_KEY_VIBRATION_ENABLED)));
+
+	/* only the bits of the mask are set */
+	CHECK(get_bits(BIT(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED)) == BIT(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED));
+
+	/* later requests are served from memory */
+	runtime_info_reset_stats();
+	get_bits(mask);
+	CHECK(runtime_info_get_stats(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, &stats) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(stats.backend_reads == 0);
+
+	/* each change of the system updates its bit */
+	vconf_set_bool(VCONFKEY_SETAPPL_ROTATE_LOCK_BOOL, 1);
+	CHECK(get_bits(mask) == mask);
+
+	vconf_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 0);
+	vconf_set_bool(VCONF_VIBRATION_ENABLED, 0);
+	CHECK(get_bits(mask) == BIT(RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED));
+
+	/* the key stays watched once the callback registered on it is removed */
+	CHECK(runtime_info_subscribe(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, changed_cb, NULL, &subscription) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(runtime_info_unsubscribe(subscription) == RUNTIME_INFO_ERROR_NONE);
+
+	vconf_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 1);
+	CHECK(get_bits(mask) == (BIT(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED) | BIT(RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED)));
+
+	/* the keys of the mask must all be boolean */
+	CHECK(runtime_info_get_bool_mask(mask | BIT(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK), &bits) == RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+	CHECK(runtime_info_get_bool_mask(mask, NULL) == RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Checks the string values lent by runtime_info_borrow_value_string():
+ * a cached value is lent again, and a borrowed value outlives a change of the key until it is released.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+static void changed_cb(runtime_info_key_e key, void *user_data)
+{
+}
+
+int main(void)
+{
+	runtime_info_subscription_h subscription;
+	runtime_info_stats_s stats;
+	const char *first;
+	const char *second;
+	const char *changed;
+	char buffer[64] = { 0 };
+
+	vconf_set_str(VCONFKEY_LANGSET, "en_US.UTF-8");
+
+	runtime_info_set_cache_enabled(true);
+	CHECK(runtime_info_subscribe(RUNTIME_INFO_KEY_LANGUAGE, changed_cb, NULL, &subscription) == RUNTIME_INFO_ERROR_NONE);
+
+	/* while cached, the same buffer is lent to every borrower */
+	CHECK(runtime_info_borrow_value_string(RUNTIME_INFO_KEY_LANGUAGE, &first) == RUNTIME_INFO_ERROR_NONE);
+	runtime_info_reset_stats();
+	CHECK(runtime_info_borrow_value_string(RUNTIME_INFO_KEY_LANGUAGE, &second) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(first == second);
+	CHECK(runtime_info_get_stats(RUNTIME_INFO_KEY_LANGUAGE, &stats) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(stats.backend_reads == 0 && stats.cache_hits == 1);
+
+	/* a change lends a new buffer, and the borrowed one keeps its value */
+	vconf_set_str(VCONFKEY_LANGSET, "ko_KR.UTF-8");
+	CHECK(runtime_info_borrow_value_string(RUNTIME_INFO_KEY_LANGUAGE, &changed) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(changed != first);
+	CHECK(!strcmp(changed, "ko_KR.UTF-8"));
+	CHECK(!strcmp(first, "en_US.UTF-8"));
+
+	CHECK(runtime_info_release_value_string(first) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(!strcmp(second, "en_US.UTF-8"));
+	CHECK(runtime_info_release_value_string(second) == RUNTIME_INFO_ERROR_NONE);
+
+	/* the item still holds the changed value after its borrower released it */
+	CHECK(runtime_info_release_value_string(changed) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(runtime_info_borrow_value_string(RUNTIME_INFO_KEY_LANGUAGE, &second) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(second == changed);
+	CHECK(runtime_info_release_value_string(second) == RUNTIME_INFO_ERROR_NONE);
+
+	/* only the borrowed values are released */
+	strcpy(buffer + 32, "en_US.UTF-8");
+	CHECK(runtime_info_release_value_string(buffer + 32) == RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+	CHECK(runtime_info_release_value_string(NULL) == RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+
+	runtime_info_unsubscribe(subscription);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Checks the reads bounded by a deadline while the read of one key stalls in the system:
+ * the stalled key times out or serves its last known value, and the other keys are still read in time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+#define TIMEOUT_MS 100
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+static unsigned long long now_ms(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (unsigned long long)now.tv_sec * 1000ULL + now.tv_nsec / 1000000;
+}
+
+int main(void)
+{
+	unsigned long long start;
+	unsigned int age_ms;
+	bool value;
+	int retcode;
+
+	vconf_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 1);
+	vconf_set_bool(VCONFKEY_SETAPPL_ROTATE_LOCK_BOOL, 1);
+
+	/* a key never read successfully has no value to fall back on */
+	vconf_standin_stall_key(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 1);
+
+	start = now_ms();
+	retcode = runtime_info_get_value_bool_timed(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, TIMEOUT_MS, RUNTIME_INFO_STALE_POLICY_LAST_KNOWN_GOOD, &value, &age_ms);
+	CHECK(retcode == RUNTIME_INFO_ERROR_TIMED_OUT);
+	CHECK(now_ms() - start >= TIMEOUT_MS - 10);
+
+	/* the other keys are read while the stalled read still holds a worker */
+	start = now_ms();
+	value = false;
+	CHECK(runtime_info_get_value_bool_timed(RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED, 5000, RUNTIME_INFO_STALE_POLICY_NONE, &value, &age_ms) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(value == true && age_ms == 0);
+	CHECK(now_ms() - start < 1000);
+
+	/* once released, the read that missed its deadline completes and becomes the last known value */
+	vconf_standin_stall_key(NULL, 0);
+	value = false;
+	CHECK(runtime_info_get_value_bool_timed(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, 5000, RUNTIME_INFO_STALE_POLICY_NONE, &value, &age_ms) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(value == true && age_ms == 0);
+
+	/* stalled again, the key serves that value with its age, or times out without the policy */
+	vconf_standin_stall_key(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 1);
+
+	value = false;
+	start = now_ms();
+	CHECK(runtime_info_get_value_bool_timed(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, TIMEOUT_MS, RUNTIME_INFO_STALE_POLICY_LAST_KNOWN_GOOD, &value, &age_ms) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(value == true);
+	CHECK(age_ms >= TIMEOUT_MS - 10 && age_ms <= now_ms() - start + 10);
+
+	CHECK(runtime_info_get_value_bool_timed(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, TIMEOUT_MS, RUNTIME_INFO_STALE_POLICY_NONE, &value, &age_ms) == RUNTIME_INFO_ERROR_TIMED_OUT);
+
+	start = now_ms();
+	CHECK(runtime_info_get_value_bool_timed(RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED, 5000, RUNTIME_INFO_STALE_POLICY_NONE, &value, &age_ms) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(now_ms() - start < 1000);
+
+	vconf_standin_stall_key(NULL, 0);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Drives vconf changes through every dispatch mode and checks which change events reach the subscribers,
+ * including when the notifications overflow the dispatch queue and when the mode changes with events queued.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+#define KEY_COUNT 4
+
+static const runtime_info_key_e keys[KEY_COUNT] = {
+	RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED,
+	RUNTIME_INFO_KEY_SILENT_MODE_ENABLED,
+	RUNTIME_INFO_KEY_VIBRATION_ENABLED,
+	RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED,
+};
+
+static const char *vconf_keys[KEY_COUNT] = {
+	VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL,
+	"db/setting/sound/sound_on",
+	"db/setting/sound/vibration_on",
+	VCONFKEY_SETAPPL_ROTATE_LOCK_BOOL,
+};
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static int delivered[KEY_COUNT];
+static bool delivered_value[KEY_COUNT];
+static pthread_t delivered_thread;
+
+static void changed_cb(runtime_info_key_e key, runtime_info_data_type_e data_type, const runtime_info_value_u *value,
+	unsigned long long timestamp_us, unsigned int sequence, void *user_data)
+{
+	int index = (int)(long)user_data;
+
+	pthread_mutex_lock(&mutex);
+	delivered[index]++;
+	delivered_value[index] = value->b;
+	delivered_thread = pthread_self();
+	pthread_mutex_unlock(&mutex);
+}
+
+static void reset(void)
+{
+	pthread_mutex_lock(&mutex);
+	memset(delivered, 0, sizeof(delivered));
+	pthread_mutex_unlock(&mutex);
+}
+
+static int get_delivered(int index, bool *value)
+{
+	int count;
+
+	pthread_mutex_lock(&mutex);
+	count = delivered[index];
+	*value = delivered_value[index];
+	pthread_mutex_unlock(&mutex);
+
+	return count;
+}
+
+/* sets every key count times, alternating its value, and returns the value set last */
+static bool toggle(int count, bool first)
+{
+	bool value = first;
+	int round;
+	int index;
+
+	for (round = 0; round < count; round++)
+	{
+		value = (round % 2 == 0) ? first : !first;
+
+		for (index = 0; index < KEY_COUNT; index++)
+		{
+			vconf_set_bool(vconf_keys[index], value);
+		}
+	}
+
+	return value;
+}
+
+/* waits up to two seconds for the library thread to deliver value to every key */
+static bool wait_delivered(bool value)
+{
+	bool delivered_value;
+	int retry;
+	int index;
+
+	for (retry = 0; retry < 2000; retry++)
+	{
+		for (index = 0; index < KEY_COUNT; index++)
+		{
+			if (get_delivered(index, &delivered_value) == 0 || delivered_value != value)
+			{
+				break;
+			}
+		}
+
+		if (index == KEY_COUNT)
+		{
+			return true;
+		}
+
+		usleep(1000);
+	}
+
+	return false;
+}
+
+static void check_delivered_once(bool value)
+{
+	bool delivered_value;
+	int index;
+
+	for (index = 0; index < KEY_COUNT; index++)
+	{
+		CHECK(get_delivered(index, &delivered_value) == 1);
+		CHECK(delivered_value == value);
+	}
+}
+
+static volatile bool stop = false;
+
+static void *switch_thread(void *data)
+{
+	while (stop == false)
+	{
+		runtime_info_set_dispatch_mode(RUNTIME_INFO_DISPATCH_MODE_EVENT_FD);
+		runtime_info_set_dispatch_mode(RUNTIME_INFO_DISPATCH_MODE_DIRECT);
+	}
+
+	return NULL;
+}
+
+int main(void)
+{
+	runtime_info_subscription_h subscriptions[KEY_COUNT];
+	struct pollfd pollfd = { .events = POLLIN };
+	pthread_t thread;
+	bool value;
+	int index;
+
+	for (index = 0; index < KEY_COUNT; index++)
+	{
+		vconf_set_bool(vconf_keys[index], false);
+		CHECK(runtime_info_subscribe_value(keys[index], changed_cb, (void *)(long)index, &subscriptions[index]) == RUNTIME_INFO_ERROR_NONE);
+	}
+
+	/* direct mode: each change is delivered from vconf_set_bool() itself */
+	reset();
+	toggle(1, true);
+	check_delivered_once(true);
+
+	/* event fd mode: nothing is delivered until the events are processed, and a queue overflow is coalesced */
+	CHECK(runtime_info_get_event_fd(&pollfd.fd) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(poll(&pollfd, 1, 0) == 0);
+
+	reset();
+	CHECK(toggle(101, false) == false);
+
+	for (index = 0; index < KEY_COUNT; index++)
+	{
+		CHECK(get_delivered(index, &value) == 0);
+	}
+
+	CHECK(poll(&pollfd, 1, 0) == 1);
+	CHECK(runtime_info_process_events() == RUNTIME_INFO_ERROR_NONE);
+	check_delivered_once(false);
+	CHECK(poll(&pollfd, 1, 0) == 0);
+
+	/* the events left queued when going back to direct mode are delivered by the switch */
+	reset();
+	toggle(3, true);
+	CHECK(runtime_info_set_dispatch_mode(RUNTIME_INFO_DISPATCH_MODE_DIRECT) == RUNTIME_INFO_ERROR_NONE);
+	check_delivered_once(true);
+
+	/* thread mode: the changes are delivered by the library thread, the latest value last */
+	CHECK(runtime_info_set_dispatch_mode(RUNTIME_INFO_DISPATCH_MODE_THREAD) == RUNTIME_INFO_ERROR_NONE);
+	reset();
+	value = toggle(151, false);
+	CHECK(wait_delivered(value));
+	CHECK(pthread_equal(delivered_thread, pthread_self()) == 0);
+
+	/* a change notified while another thread switches back to direct mode is never left in the queue */
+	CHECK(runtime_info_set_dispatch_mode(RUNTIME_INFO_DISPATCH_MODE_DIRECT) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(wait_delivered(value));
+	pthread_create(&thread, NULL, switch_thread, NULL);
+	value = toggle(2001, !value);
+	stop = true;
+	pthread_join(thread, NULL);
+	CHECK(runtime_info_set_dispatch_mode(RUNTIME_INFO_DISPATCH_MODE_DIRECT) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(wait_delivered(value));
+
+	for (index = 0; index < KEY_COUNT; index++)
+	{
+		runtime_info_unsubscribe(subscriptions[index]);
+	}
+
+	return failures == 0 ? 0 : 1;
+}
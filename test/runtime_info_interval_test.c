@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Checks the coalescing of change events by runtime_info_set_changed_cb_interval():
+ * a burst of changes within the interval gives one change event at its end, with the final value.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+#define VCONF_FIRST_DAY_OF_WEEK "db/setting/weekofday_format"
+#define INTERVAL_MS 100
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static int events = 0;
+static int last_value = -1;
+
+static void changed_cb(runtime_info_key_e key, runtime_info_data_type_e data_type, const runtime_info_value_u *value,
+	unsigned long long timestamp_us, unsigned int sequence, void *user_data)
+{
+	pthread_mutex_lock(&mutex);
+	events++;
+	last_value = value->i;
+	pthread_mutex_unlock(&mutex);
+}
+
+static int get_events(int *value)
+{
+	int count;
+
+	pthread_mutex_lock(&mutex);
+	count = events;
+	*value = last_value;
+	pthread_mutex_unlock(&mutex);
+
+	return count;
+}
+
+int main(void)
+{
+	runtime_info_subscription_h subscription;
+	runtime_info_stats_s stats;
+	int value;
+
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 0);
+
+	CHECK(runtime_info_subscribe_value(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, changed_cb, NULL, &subscription) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(runtime_info_set_changed_cb_interval(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, INTERVAL_MS) == RUNTIME_INFO_ERROR_NONE);
+	runtime_info_reset_stats();
+
+	/* the first change is delivered at once, the burst that follows once at the end of the interval */
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 1);
+	CHECK(get_events(&value) == 1);
+	CHECK(value == RUNTIME_INFO_FIRST_DAY_OF_WEEK_MONDAY);
+
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 2);
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 3);
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 4);
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 5);
+	CHECK(get_events(&value) == 1);
+
+	usleep(INTERVAL_MS * 3000);
+	CHECK(get_events(&value) == 2);
+	CHECK(value == RUNTIME_INFO_FIRST_DAY_OF_WEEK_FRIDAY);
+
+	/* only the changes of the system are counted as notifications, not the end of the interval */
+	CHECK(runtime_info_get_stats(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, &stats) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(stats.notifications == 5);
+	CHECK(stats.callbacks == 2);
+
+	/* a burst that ends on the value of the last event gives no event at the end of the interval */
+	usleep(INTERVAL_MS * 2000);
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 2);
+	CHECK(get_events(&value) == 3);
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 3);
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 2);
+
+	usleep(INTERVAL_MS * 3000);
+	CHECK(get_events(&value) == 3);
+	CHECK(value == RUNTIME_INFO_FIRST_DAY_OF_WEEK_TUESDAY);
+
+	runtime_info_unsubscribe(subscription);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Points the power supply source at a temporary directory laid out like /sys/class/power_supply
+ * and checks the keys it serves, including the fallback to vconf when an attribute is missing.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+static char root[] = "/tmp/runtime-info-power-supply-XXXXXX";
+
+static void write_attribute(const char *supply, const char *attribute, const char *value)
+{
+	char path[256];
+	FILE *file;
+
+	snprintf(path, sizeof(path), "%s/%s", root, supply);
+	mkdir(path, 0755);
+
+	snprintf(path, sizeof(path), "%s/%s/%s", root, supply, attribute);
+	file = fopen(path, "w");
+
+	if (file == NULL)
+	{
+		perror(path);
+		exit(1);
+	}
+
+	fprintf(file, "%s\n", value);
+	fclose(file);
+}
+
+static void remove_attribute(const char *supply, const char *attribute)
+{
+	char path[256];
+
+	snprintf(path, sizeof(path), "%s/%s/%s", root, supply, attribute);
+	unlink(path);
+}
+
+static void remove_supply(const char *supply)
+{
+	char path[256];
+
+	remove_attribute(supply, "type");
+	remove_attribute(supply, "status");
+	remove_attribute(supply, "online");
+
+	snprintf(path, sizeof(path), "%s/%s", root, supply);
+	rmdir(path);
+}
+
+static bool get_bool(runtime_info_key_e key)
+{
+	bool value = false;
+
+	CHECK(runtime_info_get_value_bool(key, &value) == RUNTIME_INFO_ERROR_NONE);
+
+	return value;
+}
+
+int main(void)
+{
+	if (mkdtemp(root) == NULL)
+	{
+		perror("mkdtemp");
+		return 1;
+	}
+
+	vconf_set_int(VCONFKEY_SYSMAN_BATTERY_CHARGE_NOW, 0);
+	vconf_set_int(VCONFKEY_SYSMAN_CHARGER_STATUS, VCONFKEY_SYSMAN_CHARGER_DISCONNECTED);
+
+	/* the attributes are read from the directory, not from vconf */
+	write_attribute("BAT0", "type", "Battery");
+	write_attribute("BAT0", "status", "Charging");
+	write_attribute("AC", "type", "Mains");
+	write_attribute("AC", "online", "1");
+	runtime_info_power_supply_set_root(root);
+
+	CHECK(get_bool(RUNTIME_INFO_KEY_BATTERY_IS_CHARGING) == true);
+	CHECK(get_bool(RUNTIME_INFO_KEY_CHARGER_CONNECTED) == true);
+
+	/* the files stay open and each read sees the current content */
+	write_attribute("BAT0", "status", "Discharging");
+	write_attribute("AC", "online", "0");
+
+	CHECK(get_bool(RUNTIME_INFO_KEY_BATTERY_IS_CHARGING) == false);
+	CHECK(get_bool(RUNTIME_INFO_KEY_CHARGER_CONNECTED) == false);
+
+	/* a charger is connected as soon as any non-battery supply is online */
+	write_attribute("USB", "type", "USB");
+	write_attribute("USB", "online", "1");
+	runtime_info_power_supply_set_root(root);
+
+	CHECK(get_bool(RUNTIME_INFO_KEY_CHARGER_CONNECTED) == true);
+
+	/* without the attributes, the keys fall back to vconf */
+	remove_attribute("BAT0", "status");
+	remove_attribute("AC", "online");
+	remove_attribute("USB", "online");
+	runtime_info_power_supply_set_root(root);
+
+	vconf_set_int(VCONFKEY_SYSMAN_BATTERY_CHARGE_NOW, 1);
+	vconf_set_int(VCONFKEY_SYSMAN_CHARGER_STATUS, VCONFKEY_SYSMAN_CHARGER_CONNECTED);
+
+	CHECK(get_bool(RUNTIME_INFO_KEY_BATTERY_IS_CHARGING) == true);
+	CHECK(get_bool(RUNTIME_INFO_KEY_CHARGER_CONNECTED) == true);
+
+	vconf_set_int(VCONFKEY_SYSMAN_BATTERY_CHARGE_NOW, 0);
+	vconf_set_int(VCONFKEY_SYSMAN_CHARGER_STATUS, VCONFKEY_SYSMAN_CHARGER_DISCONNECTED);
+
+	CHECK(get_bool(RUNTIME_INFO_KEY_BATTERY_IS_CHARGING) == false);
+	CHECK(get_bool(RUNTIME_INFO_KEY_CHARGER_CONNECTED) == false);
+
+	/* the same goes for a directory that does not exist, or a disabled source */
+	runtime_info_power_supply_set_root("/nonexistent");
+	CHECK(get_bool(RUNTIME_INFO_KEY_CHARGER_CONNECTED) == false);
+
+	runtime_info_power_supply_set_root(NULL);
+	vconf_set_int(VCONFKEY_SYSMAN_BATTERY_CHARGE_NOW, 1);
+	CHECK(get_bool(RUNTIME_INFO_KEY_BATTERY_IS_CHARGING) == true);
+
+	remove_supply("BAT0");
+	remove_supply("AC");
+	remove_supply("USB");
+	rmdir(root);
+
+	return failures == 0 ? 0 : 1;
+}
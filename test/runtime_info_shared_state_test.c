@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Checks the shared state page: a value published by a producer process is read back by this process,
+ * and pages forged from a copy of it are rejected.
+ * The offsets of the header fields below follow the layout of runtime_info_shm_page_s.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+#define SHM_NAME "/capi-system-runtime-info"
+#define SHM_MAGIC_OFFSET 0
+#define SHM_VERSION_OFFSET 4
+#define SHM_KEY_COUNT_OFFSET 8
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+/* publishes the flight mode on, which this process does not see through its own stand-in */
+static void producer(int command, int reply)
+{
+	char byte = 0;
+
+	vconf_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 1);
+
+	byte = (runtime_info_publish_shared_state() == RUNTIME_INFO_ERROR_NONE);
+	write(reply, &byte, 1);
+
+	/* the page is unpublished on the first command, the process exits on the second */
+	read(command, &byte, 1);
+	runtime_info_unpublish_shared_state();
+	write(reply, &byte, 1);
+
+	read(command, &byte, 1);
+	_exit(0);
+}
+
+static bool read_flight_mode(void)
+{
+	bool flight_mode = false;
+
+	/* enabling the shared state again makes the next read look the page up */
+	runtime_info_set_shared_state_enabled(true);
+	CHECK(runtime_info_get_value_bool(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, &flight_mode) == RUNTIME_INFO_ERROR_NONE);
+
+	return flight_mode;
+}
+
+/* replaces the page with a copy of the one the producer published, patched at the offset */
+static void forge(const char *page, size_t size, size_t offset, unsigned int field, mode_t mode)
+{
+	char *copy = malloc(size);
+	int fd;
+
+	memcpy(copy, page, size);
+
+	if (offset < size)
+	{
+		memcpy(copy + offset, &field, sizeof(field));
+	}
+
+	shm_unlink(SHM_NAME);
+	fd = shm_open(SHM_NAME, O_RDWR | O_CREAT | O_EXCL, 0600);
+	CHECK(fd >= 0);
+	CHECK(write(fd, copy, size) == size);
+	fchmod(fd, mode);
+	close(fd);
+
+	free(copy);
+}
+
+int main(void)
+{
+	runtime_info_stats_s stats;
+	struct stat status;
+	int command[2];
+	int reply[2];
+	char *page;
+	char byte;
+	pid_t pid;
+	int fd;
+
+	shm_unlink(SHM_NAME);
+
+	if (pipe(command) < 0 || pipe(reply) < 0)
+	{
+		return 1;
+	}
+
+	pid = fork();
+
+	if (pid == 0)
+	{
+		producer(command[0], reply[1]);
+	}
+
+	vconf_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 0);
+
+	CHECK(read(reply[0], &byte, 1) == 1 && byte == 1);
+
+	/* the value of the producer is read without reading the system */
+	runtime_info_reset_stats();
+	CHECK(read_flight_mode() == true);
+	CHECK(runtime_info_get_stats(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, &stats) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(stats.backend_reads == 0);
+
+	fd = shm_open(SHM_NAME, O_RDONLY, 0);
+	CHECK(fd >= 0 && fstat(fd, &status) == 0);
+	page = malloc(status.st_size);
+	CHECK(read(fd, page, status.st_size) == status.st_size);
+	close(fd);
+
+	/* once unpublished, the system is read again */
+	write(command[1], &byte, 1);
+	CHECK(read(reply[0], &byte, 1) == 1);
+	CHECK(read_flight_mode() == false);
+
+	forge(page, status.st_size, SHM_MAGIC_OFFSET, 0x12345678, 0644);
+	CHECK(read_flight_mode() == false);
+
+	forge(page, status.st_size, SHM_VERSION_OFFSET, 1, 0644);
+	CHECK(read_flight_mode() == false);
+
+	forge(page, status.st_size, SHM_KEY_COUNT_OFFSET, 0xffff, 0644);
+	CHECK(read_flight_mode() == false);
+
+	/* any process of the group could have written it */
+	forge(page, status.st_size, status.st_size, 0, 0664);
+	CHECK(read_flight_mode() == false);
+
+	/* the unmodified copy is accepted while its producer runs, and dropped once it exited */
+	forge(page, status.st_size, status.st_size, 0, 0644);
+	CHECK(read_flight_mode() == true);
+
+	write(command[1], &byte, 1);
+	waitpid(pid, NULL, 0);
+	CHECK(read_flight_mode() == false);
+
+	shm_unlink(SHM_NAME);
+	free(page);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Checks several subscriptions on one key: each is notified of every change once, through one watch of the system,
+ * and a subscription cancelled from within a callback, its own or another one, is not notified afterwards.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+#define SUBSCRIPTIONS 4
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+typedef struct {
+	runtime_info_subscription_h subscription;
+	runtime_info_subscription_h cancel;
+	int events;
+} subscriber_s;
+
+static subscriber_s subscribers[SUBSCRIPTIONS];
+static int rotation_lock = 0;
+
+static void changed_cb(runtime_info_key_e key, void *user_data)
+{
+	subscriber_s *subscriber = user_data;
+
+	subscriber->events++;
+
+	if (subscriber->cancel != NULL)
+	{
+		CHECK(runtime_info_unsubscribe(subscriber->cancel) == RUNTIME_INFO_ERROR_NONE);
+		subscriber->cancel = NULL;
+	}
+}
+
+static void toggle(void)
+{
+	rotation_lock = !rotation_lock;
+	vconf_set_bool(VCONFKEY_SETAPPL_ROTATE_LOCK_BOOL, rotation_lock);
+}
+
+static void check_events(int first, int second, int third, int fourth)
+{
+	CHECK(subscribers[0].events == first);
+	CHECK(subscribers[1].events == second);
+	CHECK(subscribers[2].events == third);
+	CHECK(subscribers[3].events == fourth);
+}
+
+int main(void)
+{
+	runtime_info_stats_s stats;
+	int index;
+
+	vconf_set_bool(VCONFKEY_SETAPPL_ROTATE_LOCK_BOOL, rotation_lock);
+
+	for (index = 0; index < SUBSCRIPTIONS; index++)
+	{
+		CHECK(runtime_info_subscribe(RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED, changed_cb, &subscribers[index],
+			&subscribers[index].subscription) == RUNTIME_INFO_ERROR_NONE);
+	}
+
+	/* one notification of the system reaches every subscription */
+	runtime_info_reset_stats();
+	toggle();
+	check_events(1, 1, 1, 1);
+	CHECK(runtime_info_get_stats(RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED, &stats) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(stats.notifications == 1 && stats.callbacks == SUBSCRIPTIONS);
+
+	/* the others keep being notified once one is cancelled */
+	CHECK(runtime_info_unsubscribe(subscribers[1].subscription) == RUNTIME_INFO_ERROR_NONE);
+	toggle();
+	check_events(2, 1, 2, 2);
+
+	/* cancelled from its own callback, the subscription gets that change and no other */
+	subscribers[0].cancel = subscribers[0].subscription;
+	toggle();
+	check_events(3, 1, 3, 3);
+	toggle();
+	check_events(3, 1, 4, 4);
+
+	/* cancelled from the callback of another subscription, it is not notified of the change in progress */
+	subscribers[2].cancel = subscribers[3].subscription;
+	toggle();
+	check_events(3, 1, 5, 4);
+
+	/* the last cancellation stops watching the system */
+	CHECK(runtime_info_unsubscribe(subscribers[2].subscription) == RUNTIME_INFO_ERROR_NONE);
+	runtime_info_reset_stats();
+	toggle();
+	check_events(3, 1, 5, 4);
+	CHECK(runtime_info_get_stats(RUNTIME_INFO_KEY_ROTATION_LOCK_ENABLED, &stats) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(stats.notifications == 0);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Feeds canned kobject uevent messages to runtime_info_uevent_process(), as the listener thread does,
+ * and checks the values and change events of the keys they map to.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+#include <runtime_info_private.h>
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+static unsigned long long notified = 0;
+
+static void changed_cb(runtime_info_key_e key, void *user_data)
+{
+	notified |= 1ULL << key;
+}
+
+/* the message is copied to a buffer of its exact length, with no terminating NUL after the last field */
+static void send_uevent(const char *message, int length)
+{
+	char *buffer = malloc(length);
+
+	memcpy(buffer, message, length);
+	notified = 0;
+	runtime_info_uevent_process(buffer, length);
+	free(buffer);
+}
+
+#define SEND_UEVENT(message) send_uevent(message, sizeof(message) - 1)
+
+static bool get_bool(runtime_info_key_e key)
+{
+	bool value = false;
+
+	CHECK(runtime_info_get_value_bool(key, &value) == RUNTIME_INFO_ERROR_NONE);
+
+	return value;
+}
+
+static int get_int(runtime_info_key_e key)
+{
+	int value = -1;
+
+	CHECK(runtime_info_get_value_int(key, &value) == RUNTIME_INFO_ERROR_NONE);
+
+	return value;
+}
+
+int main(void)
+{
+	runtime_info_subscription_h jack_connected;
+	runtime_info_subscription_h jack_status;
+	runtime_info_subscription_h usb;
+	runtime_info_subscription_h charger;
+	runtime_info_value_u value;
+
+	vconf_set_int(VCONFKEY_SYSMAN_EARJACK, VCONFKEY_SYSMAN_EARJACK_REMOVED);
+	vconf_set_int(VCONFKEY_SYSMAN_USB_STATUS, VCONFKEY_SYSMAN_USB_DISCONNECTED);
+	vconf_set_int(VCONFKEY_SYSMAN_CHARGER_STATUS, VCONFKEY_SYSMAN_CHARGER_DISCONNECTED);
+
+	CHECK(runtime_info_subscribe(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED, changed_cb, NULL, &jack_connected) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(runtime_info_subscribe(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS, changed_cb, NULL, &jack_status) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(runtime_info_subscribe(RUNTIME_INFO_KEY_USB_CONNECTED, changed_cb, NULL, &usb) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(runtime_info_subscribe(RUNTIME_INFO_KEY_CHARGER_CONNECTED, changed_cb, NULL, &charger) == RUNTIME_INFO_ERROR_NONE);
+
+	/* a headset with a microphone, then a headphone, then nothing */
+	SEND_UEVENT("change@/devices/virtual/switch/h2w\0ACTION=change\0SUBSYSTEM=switch\0SWITCH_NAME=h2w\0SWITCH_STATE=1");
+	CHECK(notified == ((1ULL << RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED) | (1ULL << RUNTIME_INFO_KEY_AUDIO_JACK_STATUS)));
+	CHECK(get_bool(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED) == true);
+	CHECK(get_int(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS) == RUNTIME_INFO_AUDIO_JACK_STATUS_CONNECTED_4WIRE);
+
+	SEND_UEVENT("change@/devices/virtual/switch/h2w\0ACTION=change\0SUBSYSTEM=switch\0SWITCH_NAME=h2w\0SWITCH_STATE=2");
+	CHECK(get_bool(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED) == true);
+	CHECK(get_int(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS) == RUNTIME_INFO_AUDIO_JACK_STATUS_CONNECTED_3WIRE);
+
+	SEND_UEVENT("change@/devices/virtual/switch/h2w\0ACTION=change\0SUBSYSTEM=switch\0SWITCH_NAME=h2w\0SWITCH_STATE=0");
+	CHECK(notified == ((1ULL << RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED) | (1ULL << RUNTIME_INFO_KEY_AUDIO_JACK_STATUS)));
+	CHECK(get_bool(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED) == false);
+	CHECK(get_int(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS) == RUNTIME_INFO_AUDIO_JACK_STATUS_UNCONNECTED);
+
+	/* USB is connected once configured, as VCONFKEY_SYSMAN_USB_AVAILABLE, and not when only the cable is */
+	SEND_UEVENT("change@/devices/virtual/android_usb/android0\0SUBSYSTEM=android_usb\0USB_STATE=CONNECTED");
+	CHECK(get_bool(RUNTIME_INFO_KEY_USB_CONNECTED) == false);
+
+	SEND_UEVENT("change@/devices/virtual/android_usb/android0\0SUBSYSTEM=android_usb\0USB_STATE=CONFIGURED");
+	CHECK(notified == (1ULL << RUNTIME_INFO_KEY_USB_CONNECTED));
+	CHECK(get_bool(RUNTIME_INFO_KEY_USB_CONNECTED) == true);
+
+	SEND_UEVENT("change@/devices/virtual/android_usb/android0\0SUBSYSTEM=android_usb\0USB_STATE=DISCONNECTED");
+	CHECK(notified == (1ULL << RUNTIME_INFO_KEY_USB_CONNECTED));
+	CHECK(get_bool(RUNTIME_INFO_KEY_USB_CONNECTED) == false);
+
+	/* a plugged cable defers to vconf for the configuration, an unplugged one is disconnected */
+	vconf_set_int(VCONFKEY_SYSMAN_USB_STATUS, VCONFKEY_SYSMAN_USB_AVAILABLE);
+	SEND_UEVENT("change@/devices/virtual/switch/usb_cable\0SUBSYSTEM=switch\0SWITCH_NAME=usb_cable\0SWITCH_STATE=1");
+	CHECK(get_bool(RUNTIME_INFO_KEY_USB_CONNECTED) == true);
+
+	SEND_UEVENT("change@/devices/virtual/switch/usb_cable\0SUBSYSTEM=switch\0SWITCH_NAME=usb_cable\0SWITCH_STATE=0");
+	CHECK(get_bool(RUNTIME_INFO_KEY_USB_CONNECTED) == false);
+
+	/* power_supply uevents only notify, the value is still read from its source */
+	vconf_set_int(VCONFKEY_SYSMAN_CHARGER_STATUS, VCONFKEY_SYSMAN_CHARGER_CONNECTED);
+	SEND_UEVENT("change@/devices/platform/battery/power_supply/ac\0SUBSYSTEM=power_supply\0POWER_SUPPLY_ONLINE=1");
+	CHECK(get_bool(RUNTIME_INFO_KEY_CHARGER_CONNECTED) == true);
+
+	SEND_UEVENT("change@/devices/platform/battery/power_supply/ac\0SUBSYSTEM=power_supply\0POWER_SUPPLY_ONLINE=1");
+	CHECK(notified == 0);
+
+	/* a field cut at the end of the message, or a longer name, does not match */
+	SEND_UEVENT("change@/devices/virtual/switch/h2w\0SUBSYSTEM=switch\0SWITCH_STATE=1\0SWITCH_NAME=h2");
+	SEND_UEVENT("change@/devices/virtual/switch/h2w\0SUBSYSTEM=switches\0SWITCH_NAME=h2w\0SWITCH_STATE=1");
+	SEND_UEVENT("SUBSYSTEM=swi");
+	SEND_UEVENT("");
+	CHECK(notified == 0);
+	CHECK(get_bool(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED) == false);
+
+	/* once unwatched, a key is read from vconf again and its uevents are ignored */
+	SEND_UEVENT("change@/devices/virtual/switch/h2w\0SUBSYSTEM=switch\0SWITCH_NAME=h2w\0SWITCH_STATE=1");
+	CHECK(runtime_info_uevent_get_value(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED, &value) == RUNTIME_INFO_ERROR_NONE);
+
+	runtime_info_unsubscribe(jack_connected);
+	CHECK(runtime_info_uevent_get_value(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED, &value) != RUNTIME_INFO_ERROR_NONE);
+	CHECK(get_bool(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED) == false);
+
+	SEND_UEVENT("change@/devices/virtual/switch/h2w\0SUBSYSTEM=switch\0SWITCH_NAME=h2w\0SWITCH_STATE=2");
+	CHECK(notified == (1ULL << RUNTIME_INFO_KEY_AUDIO_JACK_STATUS));
+	CHECK(get_int(RUNTIME_INFO_KEY_AUDIO_JACK_STATUS) == RUNTIME_INFO_AUDIO_JACK_STATUS_CONNECTED_3WIRE);
+	CHECK(runtime_info_uevent_get_value(RUNTIME_INFO_KEY_AUDIO_JACK_CONNECTED, &value) != RUNTIME_INFO_ERROR_NONE);
+
+	runtime_info_unsubscribe(jack_status);
+	runtime_info_unsubscribe(usb);
+	runtime_info_unsubscribe(charger);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Checks the change events delivered with their value: the value and sequence number they carry,
+ * and their order when changes are detected from several threads and from within a callback.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+#define VCONF_FIRST_DAY_OF_WEEK "db/setting/weekofday_format"
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int last_sequence = 0;
+static int last_value = -1;
+static int events = 0;
+static int reentered = 0;
+static bool out_of_order = false;
+
+static void changed_cb(runtime_info_key_e key, runtime_info_data_type_e data_type, const runtime_info_value_u *value,
+	unsigned long long timestamp_us, unsigned int sequence, void *user_data)
+{
+	pthread_mutex_lock(&mutex);
+
+	if (events > 0 && (int)(sequence - last_sequence) <= 0)
+	{
+		out_of_order = true;
+	}
+
+	last_sequence = sequence;
+	last_value = value->i;
+	events++;
+
+	pthread_mutex_unlock(&mutex);
+
+	/* the first event changes the key again from the callback, which is delivered after this one */
+	if (user_data != NULL && __sync_fetch_and_add(&reentered, 1) == 0)
+	{
+		vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 5);
+	}
+}
+
+static void *set_thread(void *data)
+{
+	int round;
+
+	for (round = 0; round < 2000; round++)
+	{
+		vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, (int)(long)data + (round % 2) * 2);
+	}
+
+	return NULL;
+}
+
+int main(void)
+{
+	runtime_info_subscription_h subscription;
+	pthread_t threads[2];
+	int value;
+
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 0);
+
+	CHECK(runtime_info_subscribe_value(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, changed_cb, &subscription, &subscription) == RUNTIME_INFO_ERROR_NONE);
+
+	/* a change made by the callback is delivered after the event that ran it, with the next sequence number */
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 1);
+	CHECK(events == 2);
+	CHECK(last_sequence == 2);
+	CHECK(last_value == RUNTIME_INFO_FIRST_DAY_OF_WEEK_FRIDAY);
+
+	/* two threads changing the key: the sequence numbers never go back, and the last event has the final value */
+	pthread_create(&threads[0], NULL, set_thread, (void *)1L);
+	pthread_create(&threads[1], NULL, set_thread, (void *)2L);
+	pthread_join(threads[0], NULL);
+	pthread_join(threads[1], NULL);
+
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 6);
+	CHECK(runtime_info_get_value_int(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, &value) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(value == RUNTIME_INFO_FIRST_DAY_OF_WEEK_SATURDAY);
+	CHECK(last_value == RUNTIME_INFO_FIRST_DAY_OF_WEEK_SATURDAY);
+	CHECK(out_of_order == false);
+
+	runtime_info_unsubscribe(subscription);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2011 Samsung Electronics Co., Ltd All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. 
+ */
+
+/*
+ * Checks runtime_info_wait_for() and its variants: a thread waiting for a value is woken up
+ * by the change made on another thread, and times out when the value does not come.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <vconf.h>
+
+#include <runtime_info.h>
+
+#define VCONF_FIRST_DAY_OF_WEEK "db/setting/weekofday_format"
+#define TIMEOUT_MS 100
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			failures++; \
+		} \
+	} while (0)
+
+static unsigned long long now_ms(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (unsigned long long)now.tv_sec * 1000ULL + now.tv_nsec / 1000000;
+}
+
+/* makes the changes from another thread, after the waiting thread started waiting */
+static void *flight_mode_thread(void *data)
+{
+	usleep(50000);
+	vconf_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 0);
+
+	return NULL;
+}
+
+static void *first_day_of_week_thread(void *data)
+{
+	int day;
+
+	for (day = 1; day <= 5; day++)
+	{
+		usleep(20000);
+		vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, day);
+	}
+
+	return NULL;
+}
+
+static bool after_wednesday(runtime_info_key_e key, const runtime_info_value_u *value, void *user_data)
+{
+	int *evaluations = user_data;
+
+	(*evaluations)++;
+
+	return value->i > RUNTIME_INFO_FIRST_DAY_OF_WEEK_WEDNESDAY;
+}
+
+int main(void)
+{
+	unsigned long long start;
+	pthread_t thread;
+	int evaluations = 0;
+	int first_day_of_week;
+
+	vconf_set_bool(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, 1);
+	vconf_set_int(VCONF_FIRST_DAY_OF_WEEK, 0);
+
+	/* a condition already satisfied returns at once */
+	CHECK(runtime_info_wait_for_value_bool(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, true, 0) == RUNTIME_INFO_ERROR_NONE);
+
+	/* a value that does not come times out */
+	start = now_ms();
+	CHECK(runtime_info_wait_for_value_bool(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, false, TIMEOUT_MS) == RUNTIME_INFO_ERROR_TIMED_OUT);
+	CHECK(now_ms() - start >= TIMEOUT_MS - 10);
+
+	/* the change made on another thread wakes the waiting thread up */
+	start = now_ms();
+	pthread_create(&thread, NULL, flight_mode_thread, NULL);
+	CHECK(runtime_info_wait_for_value_bool(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, false, 5000) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(now_ms() - start < 1000);
+	pthread_join(thread, NULL);
+
+	/* the predicate is evaluated again on every change until it is satisfied */
+	pthread_create(&thread, NULL, first_day_of_week_thread, NULL);
+	CHECK(runtime_info_wait_for(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, after_wednesday, &evaluations, 5000) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(evaluations >= 2);
+	CHECK(runtime_info_get_value_int(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, &first_day_of_week) == RUNTIME_INFO_ERROR_NONE);
+	CHECK(first_day_of_week >= RUNTIME_INFO_FIRST_DAY_OF_WEEK_THURSDAY);
+	pthread_join(thread, NULL);
+
+	CHECK(runtime_info_wait_for_value_int(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, RUNTIME_INFO_FIRST_DAY_OF_WEEK_FRIDAY, 0) == RUNTIME_INFO_ERROR_NONE);
+
+	CHECK(runtime_info_wait_for(RUNTIME_INFO_KEY_FIRST_DAY_OF_WEEK, NULL, NULL, 0) == RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+	CHECK(runtime_info_wait_for_value_int(RUNTIME_INFO_KEY_FLIGHT_MODE_ENABLED, 0, 0) == RUNTIME_INFO_ERROR_INVALID_PARAMETER);
+
+	return failures == 0 ? 0 : 1;
+}